@@ -0,0 +1,135 @@
+// benchmarks/MicroBenchmarks.cpp
+// Google Benchmark microbenchmarks for the kernels under the solvers. The
+// end-to-end numbers come from BenchmarkRunner; these isolate one inner loop
+// each, so a change to it can be measured without the rest of a solve.
+#include "benchmark/benchmark.h"
+#include "CoreSolver/BacktrackingSolver.h"
+#include "CoreSolver/BitsetOps.h"
+#include "DataModel/DataSet.h"
+#include "Parsing/NumberParser.h"
+#include "Workload/WorkloadGenerator.h"
+#include "include/json.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+using bitset_ops::Word;
+
+// Rows with a pseudo-random half of their bits set.
+std::vector<Word> randomRow(std::size_t words, std::uint64_t seed) {
+    std::vector<Word> row(words);
+    for (Word& w : row) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        w = seed ^ (seed >> 29);
+    }
+    return row;
+}
+
+// dst |= src << shift over rows of range(0) bits; range(1) is the shift, so
+// word-aligned (64) and unaligned (e.g. 37) shifts can be compared.
+void BM_BitsetShiftOr(benchmark::State& state) {
+    const std::size_t bits = static_cast<std::size_t>(state.range(0));
+    const std::size_t shift = static_cast<std::size_t>(state.range(1));
+    const std::size_t words = bitset_ops::wordsFor(bits);
+    const std::vector<Word> src = randomRow(words, 1);
+    std::vector<Word> dst = randomRow(words, 2);
+    for (auto _ : state) {
+        bitset_ops::shiftOr(dst.data(), src.data(), words, shift);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(2 * words * sizeof(Word)));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bits));
+}
+BENCHMARK(BM_BitsetShiftOr)->ArgsProduct({{1 << 10, 1 << 14, 1 << 18, 1 << 22}, {37, 64}});
+
+// One DpSolver row update: copy the previous row, or in the row shifted by
+// the item, clear the padding. Items processed are DP cells.
+void BM_DpRowUpdate(benchmark::State& state) {
+    const std::size_t span = static_cast<std::size_t>(state.range(0)) + 1;
+    const std::size_t words = bitset_ops::wordsFor(span);
+    const std::vector<Word> prev = randomRow(words, 3);
+    std::vector<Word> cur(words);
+    const std::size_t item = span / 3 + 1;
+    for (auto _ : state) {
+        std::copy(prev.begin(), prev.end(), cur.begin());
+        bitset_ops::shiftOr(cur.data(), prev.data(), words, item);
+        bitset_ops::maskTail(cur.data(), span);
+        benchmark::DoNotOptimize(cur.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(3 * words * sizeof(Word)));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(span));
+}
+BENCHMARK(BM_DpRowUpdate)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+// Backtracking over n numbers whose total is one short of the target: every
+// branch stays feasible and none reaches the target, so the search expands
+// the full tree of 2^(n+1) - 1 nodes. Items processed are nodes.
+void BM_BacktrackingNodeExpansion(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    DataSet data;
+    data.numbers.resize(static_cast<std::size_t>(n));
+    std::iota(data.numbers.begin(), data.numbers.end(), 1);
+    data.target_sum = std::accumulate(data.numbers.begin(), data.numbers.end(), 0) + 1;
+    BacktrackingSolver solver;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(solver.solve(data, false));
+    }
+    const std::int64_t nodes = (std::int64_t{2} << n) - 1;
+    state.SetItemsProcessed(state.iterations() * nodes);
+    state.counters["nodes"] = static_cast<double>(nodes);
+}
+BENCHMARK(BM_BacktrackingNodeExpansion)->DenseRange(12, 20, 4);
+
+// number_parser::parseList over range(0) comma-separated ledger amounts.
+void BM_ParseNumberList(benchmark::State& state) {
+    WorkloadSpec spec;
+    spec.family = WorkloadFamily::Ledger;
+    spec.n = static_cast<std::size_t>(state.range(0));
+    spec.scale = 1000000;
+    const DataSet data = workload::generate(spec);
+    std::string text;
+    for (std::size_t i = 0; i < data.numbers.size(); ++i) {
+        text += (i ? ", " : "") + std::to_string(data.numbers[i]);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(number_parser::parseList(text));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParseNumberList)->RangeMultiplier(10)->Range(10, 100000);
+
+// The --save payload: the dataset plus range(0) subsets, built and dumped.
+void BM_JsonSerializeResult(benchmark::State& state) {
+    WorkloadSpec spec;
+    spec.n = 100;
+    const DataSet data = workload::generate(spec);
+    const std::vector<std::vector<int>> subsets(static_cast<std::size_t>(state.range(0)),
+                                                std::vector<int>(data.numbers.begin(), data.numbers.begin() + 10));
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        nlohmann::json j;
+        j["algorithm"] = "dp";
+        j["dataset"]["numbers"] = data.numbers;
+        j["dataset"]["target_sum"] = data.target_sum;
+        j["result"]["solution_found"] = true;
+        j["result"]["execution_time_ms"] = 1.25;
+        j["result"]["subsets"] = subsets;
+        const std::string text = j.dump(4);
+        bytes = text.size();
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JsonSerializeResult)->RangeMultiplier(10)->Range(1, 10000);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -1,17 +1,56 @@
 // src/AlgorithmSelector/SolverFactory.cpp
 #include "SolverFactory.h"
 #include <stdexcept>
+#include <utility>
 
 // Include the new header files for our concrete solver classes
 #include "CoreSolver/DpSolver.h" 
 #include "CoreSolver/BacktrackingSolver.h"
+#include "CoreSolver/SparseDpSolver.h"
+#include "CoreSolver/CountingSolver.h"
+#include "CoreSolver/KnapsackSolver.h"
+#include "CoreSolver/KnapsackDpSolver.h"
+#include "CoreSolver/KnapsackBranchBoundSolver.h"
+#include "CoreSolver/KnapsackCoreSolver.h"
+#include "CoreSolver/ApproxSolver.h"
+#include "CoreSolver/GreedySolver.h"
+#include "CoreSolver/HybridSolver.h"
+
+namespace {
+
+using SolverMaker = std::unique_ptr<ISubsetSumSolver> (*)();
+
+template <typename Solver>
+std::unique_ptr<ISubsetSumSolver> makeSolver() {
+    return std::make_unique<Solver>();
+}
+
+// Every engine the factory can build, in the order tools should list them.
+const std::pair<const char*, SolverMaker> kRegisteredSolvers[] = {
+    {"dp", makeSolver<DpSolver>},
+    {"backtrack", makeSolver<BacktrackingSolver>},
+    {"sparse", makeSolver<SparseDpSolver>},
+    {"count", makeSolver<CountingSolver>},
+    {"knapsack", makeSolver<KnapsackSolver>},
+    {"knapsack-dp", makeSolver<KnapsackDpSolver>},
+    {"knapsack-bnb", makeSolver<KnapsackBranchBoundSolver>},
+    {"knapsack-core", makeSolver<KnapsackCoreSolver>},
+    {"approx", makeSolver<ApproxSolver>},
+    {"greedy", makeSolver<GreedySolver>},
+    {"hybrid", makeSolver<HybridSolver>},
+};
+
+} // namespace
 
 std::unique_ptr<ISubsetSumSolver> SolverFactory::createSolver(const std::string& type) {
-    if (type == "dp") {
-        return std::make_unique<DpSolver>();
-    }
-    if (type == "backtrack") {
-        return std::make_unique<BacktrackingSolver>();
+    for (const auto& entry : kRegisteredSolvers) {
+        if (type == entry.first) return entry.second();
     }
     throw std::invalid_argument("Unknown solver type: " + type);
 }
+
+std::vector<std::string> SolverFactory::registeredTypes() {
+    std::vector<std::string> types;
+    for (const auto& entry : kRegisteredSolvers) types.emplace_back(entry.first);
+    return types;
+}
@@ -4,8 +4,11 @@
 #include "CoreSolver/SubsetSumSolver.h"
 #include <string>
 #include <memory>
+#include <vector>
 
 class SolverFactory {
 public:
     static std::unique_ptr<ISubsetSumSolver> createSolver(const std::string& type);
+    // Names accepted by createSolver(), in a stable display order.
+    static std::vector<std::string> registeredTypes();
 };
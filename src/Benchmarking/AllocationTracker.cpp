@@ -0,0 +1,143 @@
+// src/Benchmarking/AllocationTracker.cpp
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+
+// Plain zero-initialized thread_local: no dynamic initialization, so it is
+// safe to touch from operator new at any point of a thread's life.
+struct HeapCounters {
+    std::uint64_t allocations;
+    std::uint64_t bytes;
+    std::int64_t live;  // may dip below zero when freeing another thread's blocks
+    std::int64_t peak;
+};
+thread_local HeapCounters t_heap;
+
+std::size_t blockSize(void* p) {
+#if defined(_WIN32)
+    return _msize(p);
+#elif defined(__APPLE__)
+    return malloc_size(p);
+#else
+    return malloc_usable_size(p);
+#endif
+}
+
+void* countedAlloc(std::size_t size) {
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (!p) return nullptr;
+    const auto bytes = static_cast<std::int64_t>(blockSize(p));
+    ++t_heap.allocations;
+    t_heap.bytes += static_cast<std::uint64_t>(bytes);
+    t_heap.live += bytes;
+    if (t_heap.live > t_heap.peak) t_heap.peak = t_heap.live;
+    return p;
+}
+
+void countedFree(void* p) {
+    if (!p) return;
+    t_heap.live -= static_cast<std::int64_t>(blockSize(p));
+    std::free(p);
+}
+
+void* allocOrThrow(std::size_t size) {
+    for (;;) {
+        if (void* p = countedAlloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+std::optional<std::size_t> readStatusKib(const char* key) {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string field;
+    while (status >> field) {
+        if (field == key) {
+            std::size_t kib = 0;
+            if (status >> kib) return kib * 1024;
+            break;
+        }
+        status.ignore(4096, '\n');
+    }
+#else
+    (void)key;
+#endif
+    return std::nullopt;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return allocOrThrow(size); }
+void* operator new[](std::size_t size) { return allocOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { countedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { countedFree(p); }
+
+AllocationScope::AllocationScope(bool measure_rss)
+    : m_allocations(t_heap.allocations), m_bytes(t_heap.bytes), m_liveAtStart(t_heap.live),
+      m_outerPeak(t_heap.peak) {
+    t_heap.peak = t_heap.live;  // measure this scope's own high-water mark
+    if (measure_rss && process_memory::resetPeakRss()) m_rssAtStart = process_memory::currentRss();
+}
+
+AllocationScope::~AllocationScope() {
+    t_heap.peak = std::max(t_heap.peak, m_outerPeak);
+}
+
+MemoryUsage AllocationScope::usage() const {
+    MemoryUsage usage;
+    usage.allocations = t_heap.allocations - m_allocations;
+    usage.allocated_bytes = t_heap.bytes - m_bytes;
+    usage.peak_heap_bytes = static_cast<std::uint64_t>(std::max<std::int64_t>(0, t_heap.peak - m_liveAtStart));
+    if (m_rssAtStart) {
+        if (auto peak = process_memory::peakRss()) {
+            usage.peak_rss_delta_bytes = static_cast<std::int64_t>(*peak) - static_cast<std::int64_t>(*m_rssAtStart);
+        }
+    }
+    return usage;
+}
+
+SolverResult trackedSolve(ISubsetSumSolver& solver, const DataSetView& data, bool find_all, bool measure_rss) {
+    AllocationScope scope(measure_rss);
+    SolverResult result = solver.solve(data, find_all);
+    result.memory = scope.usage();
+    return result;
+}
+
+namespace process_memory {
+
+// Linux resets the VmHWM high-water mark when "5" is written to clear_refs,
+// so the peak can be measured per run instead of per process.
+bool resetPeakRss() {
+#ifdef __linux__
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    return static_cast<bool>(clear_refs << "5" << std::flush);
+#else
+    return false;
+#endif
+}
+
+std::optional<std::size_t> peakRss() { return readStatusKib("VmHWM:"); }
+std::optional<std::size_t> currentRss() { return readStatusKib("VmRSS:"); }
+
+} // namespace process_memory
@@ -0,0 +1,52 @@
+// src/Benchmarking/AllocationTracker.h
+#pragma once
+
+#include "CoreSolver/SubsetSumSolver.h"
+#include "DataModel/SolverResult.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// Heap accounting for solves. Linking this module replaces the global
+// operator new/delete with versions that count calls and block sizes per
+// thread (a few thread-local additions per allocation). Over-aligned
+// allocations keep the standard library's operators and are not counted.
+
+// Measures the allocations made on the current thread during its lifetime.
+// Scopes nest: an inner scope does not hide its allocations or peak from the
+// enclosing one.
+class AllocationScope {
+public:
+    // With measure_rss, the process's peak resident memory is reset (Linux)
+    // and the delta reported; that costs a couple of /proc reads, so leave it
+    // off around very short, repeated solves.
+    explicit AllocationScope(bool measure_rss = false);
+    ~AllocationScope();
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    // Usage since construction.
+    MemoryUsage usage() const;
+
+private:
+    std::uint64_t m_allocations;
+    std::uint64_t m_bytes;
+    std::int64_t m_liveAtStart;
+    std::int64_t m_outerPeak;
+    std::optional<std::size_t> m_rssAtStart;
+};
+
+// Runs solver.solve() under an AllocationScope and stores the usage in
+// SolverResult::memory.
+SolverResult trackedSolve(ISubsetSumSolver& solver, const DataSetView& data, bool find_all,
+                          bool measure_rss = false);
+
+// Resident memory of this process, from /proc/self/status (Linux only).
+namespace process_memory {
+
+// Restarts the VmHWM high-water mark; false where that is not possible.
+bool resetPeakRss();
+std::optional<std::size_t> peakRss();
+std::optional<std::size_t> currentRss();
+
+} // namespace process_memory
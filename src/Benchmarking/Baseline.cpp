@@ -0,0 +1,144 @@
+// src/Benchmarking/Baseline.cpp
+#include "Baseline.h"
+#include "BenchmarkStats.h"
+#include "include/json.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+constexpr const char* kFormat = "subset-sum-baseline";
+constexpr int kFormatVersion = 1;
+
+double median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return benchmark_stats::quantile(samples, 0.5);
+}
+
+} // namespace
+
+void Baseline::put(BaselineCase entry) {
+    for (BaselineCase& existing : cases) {
+        if (existing.name == entry.name) {
+            existing = std::move(entry);
+            return;
+        }
+    }
+    cases.push_back(std::move(entry));
+}
+
+const BaselineCase* Baseline::find(const std::string& case_name) const {
+    for (const BaselineCase& entry : cases) {
+        if (entry.name == case_name) return &entry;
+    }
+    return nullptr;
+}
+
+namespace baseline {
+
+void save(const std::string& path, const Baseline& data) {
+    nlohmann::json j;
+    j["format"] = kFormat;
+    j["version"] = kFormatVersion;
+    j["name"] = data.name;
+    j["cases"] = nlohmann::json::array();
+    for (const BaselineCase& entry : data.cases) {
+        j["cases"].push_back({{"name", entry.name}, {"samples_ms", entry.samples_ms}});
+    }
+    std::ofstream out(path);
+    if (!(out << j.dump(2) << std::endl)) throw std::runtime_error("Could not write baseline '" + path + "'.");
+}
+
+Baseline load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Could not open baseline '" + path + "'.");
+    try {
+        const nlohmann::json j = nlohmann::json::parse(in);
+        if (j.value("format", "") != kFormat) throw std::runtime_error("not a baseline file");
+        if (j.value("version", 0) != kFormatVersion) throw std::runtime_error("unsupported baseline version");
+        Baseline data;
+        data.name = j.value("name", "");
+        for (const auto& entry : j.at("cases")) {
+            data.cases.push_back({entry.at("name").get<std::string>(), entry.at("samples_ms").get<std::vector<double>>()});
+        }
+        return data;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Invalid baseline '" + path + "': " + e.what());
+    }
+}
+
+Baseline loadOrCreate(const std::string& path, const std::string& name) {
+    if (!std::ifstream(path)) return Baseline{name, {}};
+    Baseline data = load(path);
+    data.name = name;
+    return data;
+}
+
+std::vector<CaseComparison> compare(const Baseline& reference, const Baseline& current, double threshold,
+                                    double alpha) {
+    std::vector<CaseComparison> comparisons;
+    for (const BaselineCase& now : current.cases) {
+        CaseComparison comparison;
+        comparison.name = now.name;
+        if (!now.samples_ms.empty()) comparison.current_median_ms = median(now.samples_ms);
+        const BaselineCase* before = reference.find(now.name);
+        if (before && !before->samples_ms.empty()) comparison.baseline_median_ms = median(before->samples_ms);
+        if (comparison.baseline_median_ms && comparison.current_median_ms && *comparison.baseline_median_ms > 0.0) {
+            comparison.ratio = *comparison.current_median_ms / *comparison.baseline_median_ms;
+            comparison.p_value = benchmark_stats::mannWhitneyPValue(before->samples_ms, now.samples_ms);
+            comparison.significant = comparison.p_value < alpha;
+            comparison.regression = comparison.significant && comparison.ratio > 1.0 + threshold;
+            comparison.improvement = comparison.significant && comparison.ratio < 1.0 / (1.0 + threshold);
+        }
+        comparisons.push_back(comparison);
+    }
+    for (const BaselineCase& before : reference.cases) {
+        if (current.find(before.name)) continue;
+        CaseComparison comparison;
+        comparison.name = before.name;
+        if (!before.samples_ms.empty()) comparison.baseline_median_ms = median(before.samples_ms);
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
+
+int writeReport(std::ostream& out, const std::string& reference_name, const std::vector<CaseComparison>& comparisons) {
+    int regressions = 0;
+    int improvements = 0;
+    const std::streamsize precision = out.precision();
+    out << "--- Comparison with baseline '" << reference_name << "' (p50) ---\n";
+    for (const CaseComparison& c : comparisons) {
+        out << c.name << ": ";
+        if (!c.baseline_median_ms) {
+            out << "new case\n";
+            continue;
+        }
+        if (!c.current_median_ms) {
+            out << "not run\n";
+            continue;
+        }
+        std::ostringstream change;
+        change << std::fixed << std::setprecision(2) << (c.ratio >= 1.0 ? c.ratio : 1.0 / c.ratio)
+               << (c.ratio >= 1.0 ? "x slower" : "x faster");
+        out << *c.baseline_median_ms << " ms -> " << *c.current_median_ms << " ms, " << change.str()
+            << std::setprecision(2) << " (p=" << c.p_value << ")" << std::setprecision(precision);
+        if (c.regression) {
+            out << "  REGRESSION";
+            ++regressions;
+        } else if (c.improvement) {
+            out << "  improved";
+            ++improvements;
+        } else {
+            out << (c.significant ? "  (within threshold)" : "  (no significant change)");
+        }
+        out << "\n";
+    }
+    out << "Regressions: " << regressions << ", significant improvements: " << improvements << "\n";
+    return regressions;
+}
+
+} // namespace baseline
@@ -0,0 +1,54 @@
+// src/Benchmarking/Baseline.h
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Saved benchmark samples to compare later runs against. A baseline file
+// holds named cases (one per solver and input, or per sweep grid point) with
+// their raw per-iteration times, so later comparisons can test significance
+// instead of comparing two means.
+struct BaselineCase {
+    std::string name;
+    std::vector<double> samples_ms;
+};
+
+struct Baseline {
+    std::string name;  // e.g. the branch or commit it was taken on
+    std::vector<BaselineCase> cases;
+
+    // Adds the case, replacing an existing one of the same name.
+    void put(BaselineCase entry);
+    const BaselineCase* find(const std::string& case_name) const;
+};
+
+struct CaseComparison {
+    std::string name;
+    std::optional<double> baseline_median_ms;  // empty: the case is new
+    std::optional<double> current_median_ms;   // empty: the case is gone
+    double ratio = 1.0;    // current / baseline median; above 1 is slower
+    double p_value = 1.0;  // Mann-Whitney U
+    bool significant = false;
+    bool regression = false;  // significantly slower by more than the threshold
+    bool improvement = false; // significantly faster by more than the threshold
+};
+
+namespace baseline {
+
+// JSON files; load() throws std::runtime_error on unreadable or foreign files.
+void save(const std::string& path, const Baseline& data);
+Baseline load(const std::string& path);
+// Loads `path` if it exists, otherwise an empty baseline called `name`.
+Baseline loadOrCreate(const std::string& path, const std::string& name);
+
+// Compares every case of either side. `threshold` is the relative slowdown
+// that counts as a regression (0.05 = 5%) when significant at `alpha`.
+std::vector<CaseComparison> compare(const Baseline& reference, const Baseline& current,
+                                    double threshold = 0.05, double alpha = 0.05);
+
+// One line per case plus a summary; returns the number of regressions.
+int writeReport(std::ostream& out, const std::string& reference_name, const std::vector<CaseComparison>& comparisons);
+
+} // namespace baseline
@@ -1,26 +1,93 @@
 // src/Benchmarking/Benchmark.cpp
 #include "Benchmark.h"
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <cmath>
 
-BenchmarkResult BenchmarkRunner::run(ISubsetSumSolver& solver, const DataSet& data, 
-                                     int iterations, bool find_all) {
+BenchmarkResult BenchmarkRunner::run(ISubsetSumSolver& solver, const DataSetView& data,
+                                     const BenchmarkOptions& options,
+                                     const IterationCallback& on_iteration) {
     BenchmarkResult bench_result;
-    bench_result.iterations = iterations;
+    bench_result.iterations = 0;
     bench_result.solutions_found_count = 0;
     bench_result.total_time = std::chrono::duration<double, std::milli>(0);
+    bench_result.samples_ms.reserve(options.iterations > 0 ? static_cast<std::size_t>(options.iterations) : 0);
+    bench_result.cells_per_run =
+        static_cast<double>(data.numbers.size()) * (std::abs(static_cast<double>(data.target_sum)) + 1.0);
+    std::optional<PerfCounters> counters;
+    if (options.perf_counters) {
+        counters.emplace();
+        if (counters->available()) bench_result.perf = PerfCounts{};
+        else bench_result.perf_error = counters->error();
+    }
+    const bool track_rss = process_memory::resetPeakRss();
+    const std::optional<std::size_t> rss_at_start = track_rss ? process_memory::currentRss() : std::nullopt;
+    MemoryUsage memory;
+    PhaseTimes phases;
+    bool timed_phases = false;
+
+    for (int i = 0; i < options.warmup_iterations && bench_result.status == SolveStatus::Completed; ++i) {
+        bench_result.status = solver.solve(data, options.find_all).status;
+        if (bench_result.status == SolveStatus::Completed) bench_result.warmup_iterations++;
+    }
 
-    for (int i = 0; i < iterations; ++i) {
-        SolverResult result = solver.solve(data, find_all);
+    for (int i = 0; bench_result.status == SolveStatus::Completed && i < options.max_iterations; ++i) {
+        if (i >= options.iterations && bench_result.total_time >= options.min_time) break;
+        if (bench_result.perf) counters->start();
+        SolverResult result = trackedSolve(solver, data, options.find_all);
+        const PerfCounts counts = bench_result.perf ? counters->stop() : PerfCounts{};
+        bench_result.status = result.status;
+        // A timed-out or cancelled run is not a sample, so its events and heap
+        // traffic are dropped.
+        if (result.status != SolveStatus::Completed) break;
+        if (bench_result.perf) *bench_result.perf += counts;
+        memory.allocations += result.memory->allocations;
+        memory.allocated_bytes += result.memory->allocated_bytes;
+        memory.peak_heap_bytes = std::max(memory.peak_heap_bytes, result.memory->peak_heap_bytes);
+        bench_result.iterations++;
         bench_result.total_time += result.execution_time;
+        bench_result.samples_ms.push_back(result.execution_time.count());
+        if (result.phases) {
+            for (std::size_t p = 0; p < kSolvePhaseCount; ++p) phases.ms[p] += result.phases->ms[p];
+            timed_phases = true;
+        }
         if (result.solution_exists) {
             bench_result.solutions_found_count++;
         }
+        if (on_iteration) on_iteration(i, result);
     }
 
-    if (iterations > 0) {
-        bench_result.average_time = bench_result.total_time / iterations;
+    if (bench_result.iterations > 0) {
+        bench_result.average_time = bench_result.total_time / bench_result.iterations;
     } else {
         bench_result.average_time = std::chrono::duration<double, std::milli>(0);
     }
+    bench_result.stats = benchmark_stats::summarize(bench_result.samples_ms);
+    if (track_rss) bench_result.peak_rss_bytes = process_memory::peakRss();
+    if (bench_result.iterations > 0) {
+        const auto runs = static_cast<std::uint64_t>(bench_result.iterations);
+        memory.allocations = (memory.allocations + runs / 2) / runs;
+        memory.allocated_bytes = (memory.allocated_bytes + runs / 2) / runs;
+        if (bench_result.peak_rss_bytes && rss_at_start) {
+            memory.peak_rss_delta_bytes =
+                static_cast<std::int64_t>(*bench_result.peak_rss_bytes) - static_cast<std::int64_t>(*rss_at_start);
+        }
+        bench_result.memory = memory;
+        if (timed_phases) {
+            for (double& ms : phases.ms) ms /= bench_result.iterations;
+            bench_result.phases = phases;
+        }
+    }
     
     return bench_result;
 }
+
+BenchmarkResult BenchmarkRunner::run(ISubsetSumSolver& solver, const DataSetView& data, 
+                                     int iterations, bool find_all,
+                                     const IterationCallback& on_iteration) {
+    BenchmarkOptions options;
+    options.iterations = iterations;
+    options.max_iterations = iterations;
+    options.find_all = find_all;
+    return run(solver, data, options, on_iteration);
+}
@@ -1,19 +1,73 @@
 // src/Benchmarking/Benchmark.h
 #pragma once
 
+#include "BenchmarkStats.h"
+#include "PerfCounters.h"
 #include "CoreSolver/SubsetSumSolver.h"
-#include "DataModel/DataSet.h"
+#include "DataModel/DataSetView.h"
 #include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+// How many times to run. Warm-up runs fill caches and the allocator first
+// and are not measured. Measuring continues past `iterations` until the
+// samples add up to `min_time` (capped at `max_iterations`), so fast solvers
+// get enough runs for stable statistics.
+struct BenchmarkOptions {
+    int iterations = 1;
+    int warmup_iterations = 0;
+    std::chrono::duration<double, std::milli> min_time{0};
+    int max_iterations = 1000000;
+    bool find_all = false;
+    // Count hardware events around every measured iteration (PerfCounters).
+    bool perf_counters = false;
+};
 
 struct BenchmarkResult {
     int iterations;
+    int warmup_iterations = 0;
+    // Why the benchmark ended early (a solve timed out or was cancelled);
+    // Completed when every requested run finished.
+    SolveStatus status = SolveStatus::Completed;
     int solutions_found_count; // How many runs found at least one solution
     std::chrono::duration<double, std::milli> total_time;
     std::chrono::duration<double, std::milli> average_time;
+    // Execution time of each completed iteration, in run order.
+    std::vector<double> samples_ms;
+    // Percentiles, spread, confidence interval and outliers of samples_ms.
+    BenchmarkStats stats;
+    // Peak resident memory of the process while this benchmark ran, where
+    // the platform lets the peak be reset per run (Linux).
+    std::optional<std::size_t> peak_rss_bytes;
+    // Heap use per measured run: mean allocation count and bytes, largest
+    // peak of any run, and the whole benchmark's peak RSS over the resident
+    // size before it. Empty if no run completed.
+    std::optional<MemoryUsage> memory;
+    // Hardware event totals over the measured iterations, when requested and
+    // available; perf_error says why they are missing otherwise.
+    std::optional<PerfCounts> perf;
+    std::string perf_error;
+    // Mean time per measured run in each phase, when the solver records
+    // phases (see ISubsetSumSolver::setPhaseTiming).
+    std::optional<PhaseTimes> phases;
+    // DP table size of one solve, n * (target + 1): the unit for per-cell rates.
+    double cells_per_run = 0.0;
 };
 
 class BenchmarkRunner {
 public:
-    static BenchmarkResult run(ISubsetSumSolver& solver, const DataSet& data, 
-                               int iterations, bool find_all);
+    // Called after every iteration with its index and result.
+    using IterationCallback = std::function<void(int iteration, const SolverResult& result)>;
+
+    // Stops early (fewer iterations) if a solve is cancelled or times out.
+    static BenchmarkResult run(ISubsetSumSolver& solver, const DataSetView& data,
+                               const BenchmarkOptions& options,
+                               const IterationCallback& on_iteration = {});
+    // Exactly `iterations` measured runs, no warm-up.
+    static BenchmarkResult run(ISubsetSumSolver& solver, const DataSetView& data, 
+                               int iterations, bool find_all,
+                               const IterationCallback& on_iteration = {});
 };
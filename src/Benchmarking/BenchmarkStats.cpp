@@ -0,0 +1,101 @@
+// src/Benchmarking/BenchmarkStats.cpp
+#include "BenchmarkStats.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace benchmark_stats {
+
+namespace {
+
+// Two-sided 97.5% quantile of Student's t for 1..30 degrees of freedom; the
+// normal value is close enough beyond that.
+double tCritical95(std::size_t degrees_of_freedom) {
+    static const double kTable[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (degrees_of_freedom == 0) return 0.0;
+    if (degrees_of_freedom <= sizeof(kTable) / sizeof(kTable[0])) return kTable[degrees_of_freedom - 1];
+    return 1.960;
+}
+
+} // namespace
+
+double quantile(const std::vector<double>& sorted, double q) {
+    const double pos = q * static_cast<double>(sorted.size() - 1);
+    const std::size_t lo = static_cast<std::size_t>(pos);
+    const std::size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - static_cast<double>(lo));
+}
+
+BenchmarkStats summarize(std::vector<double> samples) {
+    BenchmarkStats stats;
+    stats.count = samples.size();
+    if (samples.empty()) return stats;
+    std::sort(samples.begin(), samples.end());
+
+    const double n = static_cast<double>(samples.size());
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+    if (samples.size() > 1) {
+        double squares = 0.0;
+        for (const double x : samples) squares += (x - stats.mean) * (x - stats.mean);
+        stats.stddev = std::sqrt(squares / (n - 1.0));
+    }
+    const double half_width = tCritical95(samples.size() - 1) * stats.stddev / std::sqrt(n);
+    stats.ci95_low = stats.mean - half_width;
+    stats.ci95_high = stats.mean + half_width;
+
+    stats.min = samples.front();
+    stats.p50 = quantile(samples, 0.50);
+    stats.p90 = quantile(samples, 0.90);
+    stats.p99 = quantile(samples, 0.99);
+    stats.max = samples.back();
+
+    const double q1 = quantile(samples, 0.25);
+    const double q3 = quantile(samples, 0.75);
+    const double iqr = q3 - q1;
+    for (const double x : samples) {
+        if (x < q1 - 3.0 * iqr) ++stats.outliers.low_severe;
+        else if (x < q1 - 1.5 * iqr) ++stats.outliers.low_mild;
+        else if (x > q3 + 3.0 * iqr) ++stats.outliers.high_severe;
+        else if (x > q3 + 1.5 * iqr) ++stats.outliers.high_mild;
+    }
+    return stats;
+}
+
+double mannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.empty() || b.empty()) return 1.0;
+    // Rank the pooled sample, giving tied values their average rank.
+    std::vector<std::pair<double, bool>> pooled;  // (value, from a)
+    pooled.reserve(a.size() + b.size());
+    for (const double x : a) pooled.emplace_back(x, true);
+    for (const double x : b) pooled.emplace_back(x, false);
+    std::sort(pooled.begin(), pooled.end());
+
+    const double n1 = static_cast<double>(a.size());
+    const double n2 = static_cast<double>(b.size());
+    const double total = n1 + n2;
+    double rank_sum_a = 0.0;
+    double tie_term = 0.0;  // sum of t^3 - t over groups of t tied values
+    for (std::size_t i = 0; i < pooled.size();) {
+        std::size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) ++j;
+        const double tied = static_cast<double>(j - i);
+        const double rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+        for (std::size_t k = i; k < j; ++k) {
+            if (pooled[k].second) rank_sum_a += rank;
+        }
+        tie_term += tied * tied * tied - tied;
+        i = j;
+    }
+
+    const double u = rank_sum_a - n1 * (n1 + 1.0) / 2.0;
+    const double mean = n1 * n2 / 2.0;
+    const double variance = n1 * n2 / 12.0 * ((total + 1.0) - tie_term / (total * (total - 1.0)));
+    if (variance <= 0.0) return 1.0;
+    const double z = std::max(0.0, std::abs(u - mean) - 0.5) / std::sqrt(variance);
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+} // namespace benchmark_stats
@@ -0,0 +1,49 @@
+// src/Benchmarking/BenchmarkStats.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Tukey's fences: samples beyond 1.5 (mild) or 3 (severe) interquartile
+// ranges outside the quartiles. Counts are exclusive, so a severe outlier is
+// not also counted as mild.
+struct OutlierCounts {
+    std::size_t low_severe = 0;
+    std::size_t low_mild = 0;
+    std::size_t high_mild = 0;
+    std::size_t high_severe = 0;
+
+    std::size_t total() const { return low_severe + low_mild + high_mild + high_severe; }
+};
+
+// Summary of a latency sample, all in the sample's unit (ms for benchmarks).
+struct BenchmarkStats {
+    std::size_t count = 0;
+    double mean = 0.0;
+    double stddev = 0.0;      // sample standard deviation (n - 1)
+    double ci95_low = 0.0;    // 95% confidence interval of the mean (Student's t)
+    double ci95_high = 0.0;
+    double min = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    OutlierCounts outliers;
+};
+
+namespace benchmark_stats {
+
+// Linear-interpolated quantile, q in [0, 1], of an already sorted non-empty sample.
+double quantile(const std::vector<double>& sorted, double q);
+
+// All-zero stats for an empty sample.
+BenchmarkStats summarize(std::vector<double> samples);
+
+// Two-sided p-value of the Mann-Whitney U test that samples `a` and `b` come
+// from the same distribution, using the normal approximation with tie and
+// continuity corrections (reasonable from about 8 samples each). Unlike a
+// t-test it assumes nothing about the shape of the latency distribution.
+// Returns 1 when either sample is empty or all values are equal.
+double mannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b);
+
+} // namespace benchmark_stats
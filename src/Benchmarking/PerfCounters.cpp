@@ -0,0 +1,133 @@
+// src/Benchmarking/PerfCounters.cpp
+#include "PerfCounters.h"
+#include <cstring>
+#include <utility>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+void add(std::optional<std::uint64_t>& total, const std::optional<std::uint64_t>& value) {
+    if (value) total = total.value_or(0) + *value;
+}
+
+} // namespace
+
+PerfCounts& PerfCounts::operator+=(const PerfCounts& other) {
+    add(cycles, other.cycles);
+    add(instructions, other.instructions);
+    add(llc_misses, other.llc_misses);
+    add(branches, other.branches);
+    add(branch_misses, other.branch_misses);
+    return *this;
+}
+
+std::optional<double> PerfCounts::ipc() const {
+    if (!cycles || !instructions || *cycles == 0) return std::nullopt;
+    return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+}
+
+std::optional<double> PerfCounts::branchMissRate() const {
+    if (!branches || !branch_misses || *branches == 0) return std::nullopt;
+    return static_cast<double>(*branch_misses) / static_cast<double>(*branches);
+}
+
+std::optional<double> PerfCounts::llcMissesPerMillionCells(double cells) const {
+    if (!llc_misses || cells <= 0) return std::nullopt;
+    return static_cast<double>(*llc_misses) * 1e6 / cells;
+}
+
+#ifdef __linux__
+
+namespace {
+
+int openEvent(std::uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;  // the leader switches the whole group
+    attr.exclude_kernel = 1;                // allowed at perf_event_paranoid 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+} // namespace
+
+PerfCounters::PerfCounters() {
+    m_leader = openEvent(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (m_leader < 0) {
+        m_error = std::string("perf_event_open failed: ") + std::strerror(errno);
+        return;
+    }
+    m_fds.push_back(m_leader);
+    m_events.push_back(Event::Cycles);
+
+    // Members the CPU lacks are skipped; the rest still count.
+    const std::pair<std::uint64_t, Event> members[] = {
+        {PERF_COUNT_HW_INSTRUCTIONS, Event::Instructions},
+        {PERF_COUNT_HW_CACHE_MISSES, Event::LlcMisses},
+        {PERF_COUNT_HW_BRANCH_INSTRUCTIONS, Event::Branches},
+        {PERF_COUNT_HW_BRANCH_MISSES, Event::BranchMisses},
+    };
+    for (const auto& member : members) {
+        const int fd = openEvent(member.first, m_leader);
+        if (fd < 0) continue;
+        m_fds.push_back(fd);
+        m_events.push_back(member.second);
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    for (const int fd : m_fds) close(fd);
+}
+
+void PerfCounters::start() {
+    if (!available()) return;
+    ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounts PerfCounters::stop() {
+    PerfCounts counts;
+    if (!available()) return counts;
+    ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr].
+    std::vector<std::uint64_t> buffer(3 + m_fds.size());
+    const ssize_t bytes = read(m_leader, buffer.data(), buffer.size() * sizeof(std::uint64_t));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t)) || buffer[0] != m_fds.size()) return counts;
+    const std::uint64_t enabled = buffer[1];
+    const std::uint64_t running = buffer[2];
+    if (running == 0) return counts;  // the group never got onto the PMU
+    const double scale = static_cast<double>(enabled) / static_cast<double>(running);
+
+    for (std::size_t i = 0; i < m_fds.size(); ++i) {
+        const auto value = static_cast<std::uint64_t>(static_cast<double>(buffer[3 + i]) * scale);
+        switch (m_events[i]) {
+            case Event::Cycles: counts.cycles = value; break;
+            case Event::Instructions: counts.instructions = value; break;
+            case Event::LlcMisses: counts.llc_misses = value; break;
+            case Event::Branches: counts.branches = value; break;
+            case Event::BranchMisses: counts.branch_misses = value; break;
+        }
+    }
+    return counts;
+}
+
+#else
+
+PerfCounters::PerfCounters() : m_error("hardware counters need Linux perf_event_open") {}
+PerfCounters::~PerfCounters() = default;
+void PerfCounters::start() {}
+PerfCounts PerfCounters::stop() { return {}; }
+
+#endif
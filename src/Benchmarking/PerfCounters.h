@@ -0,0 +1,55 @@
+// src/Benchmarking/PerfCounters.h
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Hardware event counts for one or more solves. A counter the CPU or kernel
+// does not offer stays empty.
+struct PerfCounts {
+    std::optional<std::uint64_t> cycles;
+    std::optional<std::uint64_t> instructions;
+    std::optional<std::uint64_t> llc_misses;  // last-level cache misses
+    std::optional<std::uint64_t> branches;
+    std::optional<std::uint64_t> branch_misses;
+
+    PerfCounts& operator+=(const PerfCounts& other);
+
+    // Instructions per cycle.
+    std::optional<double> ipc() const;
+    // Mispredicted share of branches, in [0, 1].
+    std::optional<double> branchMissRate() const;
+    // LLC misses per million DP cells, given the cells processed in total.
+    std::optional<double> llcMissesPerMillionCells(double cells) const;
+};
+
+// One perf_event_open group (cycles leading instructions, LLC misses, branches
+// and branch misses) on the calling thread, user space only. The group is
+// scheduled as a unit, so the counts of one measurement are consistent with
+// each other. Where perf events are unavailable (not Linux, no PMU in a VM,
+// perf_event_paranoid too strict) available() is false and error() says why;
+// start() and stop() then do nothing and return empty counts.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return m_leader >= 0; }
+    const std::string& error() const { return m_error; }
+
+    void start();
+    // Counts since start(), scaled up if the kernel had to multiplex the group.
+    PerfCounts stop();
+
+private:
+    enum class Event { Cycles, Instructions, LlcMisses, Branches, BranchMisses };
+
+    int m_leader = -1;
+    std::vector<int> m_fds;        // leader first, in group read order
+    std::vector<Event> m_events;   // event of each fd
+    std::string m_error;
+};
@@ -0,0 +1,40 @@
+// src/Benchmarking/ReportWriter.cpp
+#include "ReportWriter.h"
+#include <iostream>
+#include <stdexcept>
+
+void ReportWriter::add(const ReportRow& row) {
+    if (m_csv) {
+        if (!m_headerWritten) {
+            for (std::size_t i = 0; i < row.size(); ++i) *m_csv << (i ? "," : "") << report_writer::csvCell(row[i].first);
+            *m_csv << "\n";
+            m_headerWritten = true;
+        }
+        for (std::size_t i = 0; i < row.size(); ++i) *m_csv << (i ? "," : "") << report_writer::csvCell(row[i].second);
+        *m_csv << std::endl;  // rows land even if a later one is interrupted
+    }
+    nlohmann::json object;
+    for (const auto& column : row) object[column.first] = column.second;
+    m_rows.push_back(std::move(object));
+}
+
+namespace report_writer {
+
+std::string csvCell(const nlohmann::json& value) {
+    if (value.is_null()) return "";
+    if (!value.is_string()) return value.dump();
+    const std::string text = value.get<std::string>();
+    if (text.find_first_of(",\"\n") == std::string::npos) return text;
+    std::string quoted = "\"";
+    for (const char c : text) quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+    return quoted + "\"";
+}
+
+std::ostream& openOutput(const std::string& path, std::ofstream& file) {
+    if (path == "-") return std::cout;
+    file.open(path);
+    if (!file) throw std::runtime_error("Could not open '" + path + "' for writing.");
+    return file;
+}
+
+} // namespace report_writer
@@ -0,0 +1,39 @@
+// src/Benchmarking/ReportWriter.h
+#pragma once
+
+#include "include/json.hpp"
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One row of a benchmark report: column names and values, in column order.
+using ReportRow = std::vector<std::pair<std::string, nlohmann::json>>;
+
+// Streams report rows as CSV (header before the first row) and collects them
+// for a JSON array, so the bench executables write both formats alike.
+class ReportWriter {
+public:
+    // Rows go to `csv` as they arrive; nullptr only collects them.
+    explicit ReportWriter(std::ostream* csv) : m_csv(csv) {}
+
+    void add(const ReportRow& row);
+    // Every row so far, one object per row.
+    const nlohmann::json& rows() const { return m_rows; }
+
+private:
+    std::ostream* m_csv;
+    bool m_headerWritten = false;
+    nlohmann::json m_rows = nlohmann::json::array();
+};
+
+namespace report_writer {
+
+// Null becomes an empty cell; strings are quoted when they need it.
+std::string csvCell(const nlohmann::json& value);
+// std::cout for "-", otherwise `file` opened on `path`; throws
+// std::runtime_error when it cannot be opened.
+std::ostream& openOutput(const std::string& path, std::ofstream& file);
+
+} // namespace report_writer
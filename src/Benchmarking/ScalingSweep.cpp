@@ -0,0 +1,87 @@
+// src/Benchmarking/ScalingSweep.cpp
+#include "ScalingSweep.h"
+#include "AlgorithmSelector/SolverFactory.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+
+namespace scaling_sweep {
+
+int scaleFor(std::size_t n, double density) {
+    if (density <= 0.0) throw std::invalid_argument("Sweep density must be positive.");
+    const double cap = n == 0 ? INT_MAX : static_cast<double>(INT_MAX / static_cast<long long>(n));
+    const double scale = std::pow(2.0, static_cast<double>(n) / density);
+    return static_cast<int>(std::clamp(std::round(scale), 1.0, cap));
+}
+
+const char* outcomeName(SweepOutcome outcome) {
+    switch (outcome) {
+        case SweepOutcome::TimedOut: return "timeout";
+        case SweepOutcome::Skipped: return "skipped";
+        case SweepOutcome::Failed: return "error";
+        default: return "ok";
+    }
+}
+
+std::vector<SweepPoint> run(const SweepConfig& config, const std::function<void(const SweepPoint&)>& on_point) {
+    const std::vector<std::string> engines = config.engines.empty() ? SolverFactory::registeredTypes() : config.engines;
+    std::vector<std::size_t> sizes = config.sizes;
+    std::sort(sizes.begin(), sizes.end());  // so a timeout can rule out the larger sizes
+
+    BenchmarkOptions options;
+    options.iterations = config.iterations;
+    options.max_iterations = config.iterations;
+    options.warmup_iterations = config.warmup_iterations;
+    options.perf_counters = config.perf_counters;
+
+    std::set<std::tuple<std::string, int, double>> timed_out;  // (engine, target, density)
+    std::vector<SweepPoint> points;
+    for (const double density : config.densities) {
+        for (const int target : config.targets) {
+            for (const std::size_t n : sizes) {
+                WorkloadSpec spec;
+                spec.family = config.family;
+                spec.n = n;
+                spec.scale = scaleFor(n, density);
+                spec.seed = config.seed;
+                spec.target = target;
+                DataSet data = workload::generate(spec);
+                data.values = data.numbers;
+
+                for (const std::string& engine : engines) {
+                    SweepPoint point;
+                    point.engine = engine;
+                    point.n = n;
+                    point.target = target;
+                    point.density = density;
+                    point.scale = spec.scale;
+                    if (timed_out.count({engine, target, density})) {
+                        point.outcome = SweepOutcome::Skipped;
+                    } else {
+                        try {
+                            auto solver = SolverFactory::createSolver(engine);
+                            solver->setTimeout(config.timeout);
+                            solver->setPhaseTiming(config.phase_timing);
+                            point.bench = BenchmarkRunner::run(*solver, data, options);
+                            if (point.bench.status != SolveStatus::Completed) {
+                                point.outcome = SweepOutcome::TimedOut;
+                                timed_out.insert({engine, target, density});
+                            }
+                        } catch (const std::exception& e) {
+                            point.outcome = SweepOutcome::Failed;
+                            point.error = e.what();
+                        }
+                    }
+                    if (on_point) on_point(point);
+                    points.push_back(std::move(point));
+                }
+            }
+        }
+    }
+    return points;
+}
+
+} // namespace scaling_sweep
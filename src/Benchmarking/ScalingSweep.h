@@ -0,0 +1,64 @@
+// src/Benchmarking/ScalingSweep.h
+#pragma once
+
+#include "Benchmark.h"
+#include "Workload/WorkloadGenerator.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// A grid of instances to run every engine on, to find where the engines
+// cross over. Density is the usual subset-sum measure n / log2(max number):
+// each (n, density) pair fixes the generator's scale at 2^(n / density),
+// lowered where the total would not fit in an int.
+struct SweepConfig {
+    std::vector<std::size_t> sizes{10, 20, 40, 80};
+    std::vector<int> targets{1000, 10000, 100000};
+    std::vector<double> densities{0.5, 1.0, 2.0};
+    std::vector<std::string> engines;  // empty: every registered engine
+    WorkloadFamily family = WorkloadFamily::Uniform;
+    std::uint64_t seed = 1;
+    int iterations = 3;
+    int warmup_iterations = 1;
+    // Per solve. An engine that times out is skipped at the larger sizes of
+    // the same (target, density).
+    std::chrono::milliseconds timeout{1000};
+    bool perf_counters = false;
+    bool phase_timing = false;  // SolverResult::phases for the engines that record them
+};
+
+enum class SweepOutcome {
+    Ok,
+    TimedOut,
+    Skipped,  // timed out at a smaller n
+    Failed    // the engine threw (see SweepPoint::error)
+};
+
+struct SweepPoint {
+    std::string engine;
+    std::size_t n = 0;
+    int target = 0;
+    double density = 0.0;  // as requested
+    int scale = 0;         // largest number the generator could draw
+    SweepOutcome outcome = SweepOutcome::Ok;
+    std::string error;
+    BenchmarkResult bench{};
+};
+
+namespace scaling_sweep {
+
+// Instances get values equal to their numbers, so the knapsack engines solve
+// the closest-sum-within-target version of the same instance while the
+// others ignore them. Calls on_point after each grid point.
+std::vector<SweepPoint> run(const SweepConfig& config,
+                            const std::function<void(const SweepPoint&)>& on_point = {});
+
+// Scale for n numbers at the given density.
+int scaleFor(std::size_t n, double density);
+
+const char* outcomeName(SweepOutcome outcome);
+
+} // namespace scaling_sweep
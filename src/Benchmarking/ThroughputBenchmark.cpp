@@ -0,0 +1,153 @@
+// src/Benchmarking/ThroughputBenchmark.cpp
+#include "ThroughputBenchmark.h"
+#include "AllocationTracker.h"
+#include "AlgorithmSelector/SolverFactory.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Latencies kept per thread; beyond this, reservoir sampling keeps a uniform
+// sample, so the measured loop never allocates for bookkeeping.
+constexpr std::size_t kMaxSamplesPerThread = std::size_t{1} << 16;
+
+// Everything one thread writes, on its own cache lines so the harness does
+// not add false sharing of its own.
+struct alignas(64) Worker {
+    std::vector<DataSet> instances;
+    std::vector<double> samples_ms;
+    std::uint64_t solves = 0;
+    std::uint64_t found = 0;
+    MemoryUsage memory;
+    std::string error;
+};
+
+void recordLatency(Worker& worker, double ms, std::uint64_t& rng) {
+    if (worker.samples_ms.size() < kMaxSamplesPerThread) {
+        worker.samples_ms.push_back(ms);
+        return;
+    }
+    rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;  // 64-bit LCG
+    const std::uint64_t slot = (rng >> 11) % worker.solves;
+    if (slot < kMaxSamplesPerThread) worker.samples_ms[slot] = ms;
+}
+
+void solveUntilStopped(Worker& worker, ISubsetSumSolver& solver, bool find_all, std::uint64_t seed,
+                       const std::atomic<bool>& stop) {
+    std::uint64_t rng = seed;
+    std::size_t next = 0;
+    // Thread-local heap counts only: measuring RSS would reset the
+    // process-wide peak from every worker at once.
+    AllocationScope scope(false);
+    while (!stop.load(std::memory_order_relaxed)) {
+        const Clock::time_point begin = Clock::now();
+        const bool found = solver.solve(worker.instances[next], find_all).solution_exists;
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+        ++worker.solves;
+        if (found) ++worker.found;
+        recordLatency(worker, ms, rng);
+        if (++next == worker.instances.size()) next = 0;
+    }
+    worker.memory = scope.usage();
+}
+
+} // namespace
+
+namespace throughput_benchmark {
+
+std::vector<ThroughputPoint> run(const ThroughputConfig& config,
+                                 const std::function<void(const ThroughputPoint&)>& on_point) {
+    if (config.thread_counts.empty()) throw std::invalid_argument("Throughput benchmark needs a thread count.");
+    for (const int threads : config.thread_counts) {
+        if (threads < 1) throw std::invalid_argument("Thread counts must be positive.");
+    }
+    if (config.instances_per_thread == 0) throw std::invalid_argument("Each thread needs at least one instance.");
+    if (config.duration.count() <= 0) throw std::invalid_argument("Throughput duration must be positive.");
+    SolverFactory::createSolver(config.engine);  // unknown engines fail here, not on a worker
+
+    std::vector<ThroughputPoint> points;
+    for (const int threads : config.thread_counts) {
+        std::vector<Worker> workers(static_cast<std::size_t>(threads));
+        for (std::size_t t = 0; t < workers.size(); ++t) {
+            WorkloadSpec spec = config.workload;
+            for (std::size_t i = 0; i < config.instances_per_thread; ++i) {
+                spec.seed = config.workload.seed + t * config.instances_per_thread + i;
+                workers[t].instances.push_back(workload::generate(spec));
+            }
+        }
+
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> pool;
+        pool.reserve(workers.size());
+        for (std::size_t t = 0; t < workers.size(); ++t) {
+            pool.emplace_back([&, t] {
+                Worker& worker = workers[t];
+                std::unique_ptr<ISubsetSumSolver> solver;
+                try {
+                    solver = SolverFactory::createSolver(config.engine);
+                    for (const DataSet& instance : worker.instances) solver->solve(instance, config.find_all);
+                    worker.samples_ms.reserve(kMaxSamplesPerThread);
+                } catch (const std::exception& e) {
+                    worker.error = e.what();
+                }
+                ready.fetch_add(1, std::memory_order_release);
+                if (!worker.error.empty()) return;
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                try {
+                    solveUntilStopped(worker, *solver, config.find_all, t + 1, stop);
+                } catch (const std::exception& e) {
+                    worker.error = e.what();
+                }
+            });
+        }
+
+        // Start every thread at once, after all of them have warmed up.
+        while (ready.load(std::memory_order_acquire) < threads) std::this_thread::yield();
+        const Clock::time_point start = Clock::now();
+        go.store(true, std::memory_order_release);
+        std::this_thread::sleep_until(start + config.duration);
+        stop.store(true, std::memory_order_relaxed);
+        for (std::thread& thread : pool) thread.join();
+        const double wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        ThroughputPoint point;
+        point.threads = threads;
+        point.wall_ms = wall_ms;
+        std::vector<double> samples;
+        std::uint64_t allocations = 0;
+        std::uint64_t allocated_bytes = 0;
+        for (const Worker& worker : workers) {
+            if (!worker.error.empty()) {
+                throw std::runtime_error("Engine '" + config.engine + "' failed: " + worker.error);
+            }
+            point.solves += worker.solves;
+            point.solutions_found += worker.found;
+            point.solves_per_thread.push_back(worker.solves);
+            samples.insert(samples.end(), worker.samples_ms.begin(), worker.samples_ms.end());
+            allocations += worker.memory.allocations;
+            allocated_bytes += worker.memory.allocated_bytes;
+        }
+        point.solves_per_second = static_cast<double>(point.solves) / (wall_ms / 1000.0);
+        point.latency = benchmark_stats::summarize(std::move(samples));
+        if (point.solves > 0) {
+            point.allocations_per_solve = static_cast<double>(allocations) / static_cast<double>(point.solves);
+            point.allocated_bytes_per_solve = static_cast<double>(allocated_bytes) / static_cast<double>(point.solves);
+        }
+        const double per_thread = point.solves_per_second / threads;
+        const double base_per_thread =
+            points.empty() ? per_thread : points.front().solves_per_second / points.front().threads;
+        point.efficiency = base_per_thread > 0.0 ? per_thread / base_per_thread : 0.0;
+
+        if (on_point) on_point(point);
+        points.push_back(std::move(point));
+    }
+    return points;
+}
+
+} // namespace throughput_benchmark
@@ -0,0 +1,60 @@
+// src/Benchmarking/ThroughputBenchmark.h
+#pragma once
+
+#include "BenchmarkStats.h"
+#include "Workload/WorkloadGenerator.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Many small solves in parallel, the shape of production traffic. For each
+// thread count, every thread gets its own solver and its own pool of
+// generated instances and solves them round-robin until the time is up.
+// Throughput that grows less than linearly with threads points at shared
+// state: allocator contention, false sharing, memory bandwidth.
+struct ThroughputConfig {
+    std::string engine = "dp";
+    // Instance shape; thread t's instance i uses seed workload.seed + t * instances_per_thread + i,
+    // so no two threads solve the same instance.
+    WorkloadSpec workload{WorkloadFamily::Uniform, 20, 1000, 1, std::nullopt};
+    std::vector<int> thread_counts{1, 2, 4, 8};
+    std::size_t instances_per_thread = 64;
+    // Measured time per thread count, after each thread has solved its pool
+    // once as a warm-up.
+    std::chrono::milliseconds duration{1000};
+    bool find_all = false;
+};
+
+struct ThroughputPoint {
+    int threads = 0;
+    std::uint64_t solves = 0;
+    std::uint64_t solutions_found = 0;
+    double wall_ms = 0.0;
+    double solves_per_second = 0.0;
+    // Per-thread throughput relative to the first thread count's: 1 is
+    // perfect scaling.
+    double efficiency = 0.0;
+    // Per-solve latency in ms over all threads (a uniform sample of the
+    // solves when there are too many to keep).
+    BenchmarkStats latency;
+    // Heap traffic per solve; every allocation is a potential point of
+    // contention between threads. Resident memory is not reported: the
+    // process-wide peak cannot be split between concurrent workers.
+    double allocations_per_solve = 0.0;
+    double allocated_bytes_per_solve = 0.0;
+    // Solves by each thread, to spot starved threads.
+    std::vector<std::uint64_t> solves_per_thread;
+};
+
+namespace throughput_benchmark {
+
+// Throws std::invalid_argument for a bad configuration and rethrows
+// (as std::runtime_error) the first error a solve raised on any thread.
+// Calls on_point after each thread count.
+std::vector<ThroughputPoint> run(const ThroughputConfig& config,
+                                 const std::function<void(const ThroughputPoint&)>& on_point = {});
+
+} // namespace throughput_benchmark
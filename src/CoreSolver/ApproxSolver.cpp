@@ -0,0 +1,115 @@
+// src/CoreSolver/ApproxSolver.cpp
+#include "ApproxSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Sums kept by the trimmed lists live in one arena; each remembers the item
+// that created it and the sum it was extended from, so the final subset can
+// be rebuilt without per-list snapshots.
+struct SumNode {
+    int sum;
+    int item;             // -1 for the empty subset
+    std::size_t parent;   // arena index of the sum before adding `item`
+};
+
+} // namespace
+
+ApproxSolver::ApproxSolver(double epsilon) : m_epsilon(epsilon) {
+    if (!(epsilon > 0.0 && epsilon < 1.0)) {
+        throw std::invalid_argument("Approximation epsilon must be in (0, 1).");
+    }
+}
+
+SolverResult ApproxSolver::solve(const DataSetView& data, bool find_all) {
+    if (find_all) {
+        throw std::logic_error("Approximate solver does not support 'find all' mode.");
+    }
+    if (data.cardinality != CardinalityRule::None) {
+        throw std::logic_error("Approximate solver does not support cardinality constraints.");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+
+    const auto& nums = data.numbers;
+    const int target = data.target_sum;
+    for (int w : nums) {
+        if (w < 0) throw std::invalid_argument("Approximate solver requires non-negative numbers.");
+    }
+
+    SolverResult result;
+    if (target >= 0) {
+        const double delta = m_epsilon / (2.0 * static_cast<double>(std::max<std::size_t>(nums.size(), 1)));
+
+        std::vector<SumNode> arena{{0, -1, 0}};
+        std::vector<std::size_t> list{0}, merged;  // arena indices, sorted by sum
+        SolveProgress& progress = stop.progress();
+        progress.steps_total = nums.size();
+        for (std::size_t i = 0; i < nums.size(); ++i) {
+            const int w = nums[i];
+            progress.steps_done = i + 1;
+            if (w == 0 || w > target) continue;
+            if (stop.shouldStop(list.size())) break;
+
+            // Merge L with L + w (dropping sums above the target) and trim in
+            // the same pass: a sum is kept only if it exceeds the last kept
+            // one by more than a factor of 1 + delta.
+            const std::size_t base = list.size();
+            std::size_t shifted = 0;
+            while (shifted < base && arena[list[shifted]].sum <= target - w) ++shifted;
+            merged.clear();
+            double last_kept = -1.0;
+            std::size_t a = 0, b = 0;
+            while (a < base || b < shifted) {
+                if (b == shifted || (a < base && arena[list[a]].sum <= arena[list[b]].sum + w)) {
+                    const int sum = arena[list[a]].sum;
+                    if (sum > last_kept * (1.0 + delta)) {
+                        merged.push_back(list[a]);
+                        last_kept = sum;
+                    }
+                    ++a;
+                } else {
+                    const int sum = arena[list[b]].sum + w;
+                    if (sum > last_kept * (1.0 + delta)) {
+                        arena.push_back({sum, static_cast<int>(i), list[b]});
+                        merged.push_back(arena.size() - 1);
+                        last_kept = sum;
+                    }
+                    ++b;
+                }
+            }
+            list.swap(merged);
+            progress.offerGap(target - arena[list.back()].sum);
+            if (arena[list.back()].sum == target) break;
+        }
+
+        const std::size_t best = list.back();
+        std::vector<int> subset;
+        for (std::size_t node = best; arena[node].item >= 0; node = arena[node].parent) {
+            subset.push_back(nums[arena[node].item]);
+        }
+        std::reverse(subset.begin(), subset.end());
+
+        const long long achieved = arena[best].sum;
+        result.solution_exists = true;
+        result.subsets.push_back(subset);
+        result.achieved_sum = achieved;
+        // OPT <= (1 + epsilon) * achieved, and never more than the target.
+        // The guarantee needs every item processed, so a stopped solve has none.
+        if (!stop.stopped()) {
+            result.optimum_upper_bound = std::min<long long>(
+                target, static_cast<long long>(std::floor(static_cast<double>(achieved) * (1.0 + m_epsilon))));
+        }
+    }
+
+    result.status = stop.status();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
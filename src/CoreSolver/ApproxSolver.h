@@ -0,0 +1,20 @@
+// src/CoreSolver/ApproxSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+
+// Fully polynomial approximation scheme for subset sum (trimmed sum lists).
+// Returns a subset whose sum stays within the target and is at least
+// OPT / (1 + epsilon) >= (1 - epsilon) * OPT, where OPT is the best
+// achievable sum. Each list is trimmed so that consecutive sums differ by a
+// factor of at least 1 + epsilon / (2n), which keeps it at
+// O(n log(target) / epsilon) entries: time and memory grow with n and
+// 1 / epsilon, but only logarithmically with the target.
+class ApproxSolver : public ISubsetSumSolver {
+public:
+    explicit ApproxSolver(double epsilon = 0.01);
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+private:
+    double m_epsilon;
+};
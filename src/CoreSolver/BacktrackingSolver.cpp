@@ -1,48 +1,105 @@
 // src/CoreSolver/BacktrackingSolver.cpp
 #include "BacktrackingSolver.h"
 #include <chrono>
+#include <limits>
+#include <stdexcept>
 
-void BacktrackingSolver::findSubsetsRecursive(const std::vector<int>& nums, int target, size_t index, 
+void BacktrackingSolver::findSubsetsRecursive(Span<const int> nums, int target, size_t index, 
                                                 std::vector<int>& current_subset, 
-                                                SolverResult& result, bool find_all) {
+                                                SolverResult& result, bool find_all,
+                                                size_t max_items, bool exact_count, StopCondition& stop) {
     // This is the correct way to stop the search early if we only need one solution.
     if (!find_all && result.solution_exists) {
         return;
     }
 
+    // Remember the closest path so far in case the search is stopped.
+    if (target >= 0 && (m_bestGap < 0 || target < m_bestGap) &&
+        (!exact_count || current_subset.size() == max_items)) {
+        m_bestGap = target;
+        m_bestSubset.assign(current_subset.begin(), current_subset.end());
+    }
+
+    // Timeout or cancellation: unwind, keeping the solutions found so far.
+    if (stop.shouldStop()) {
+        return;
+    }
+    SolveProgress& progress = stop.progress();
+    ++progress.nodes;
+    if (target >= 0) progress.offerGap(target);
+
     // Base Case 1: A solution is found.
     // We record it and MUST return to prevent the function from exploring deeper from this point
-    // which would cause duplicates.
-    if (target == 0) {
+    // which would cause duplicates. Under an "exactly k" rule a short subset is not a solution
+    // yet, but zero-valued items may still complete it.
+    if (target == 0 && (!exact_count || current_subset.size() == max_items)) {
         result.solution_exists = true;
-        result.subsets.push_back(current_subset);
+        stop.foundSolution(current_subset);
+        if (stop.retainSolutions()) result.subsets.push_back(current_subset);
         return; 
     }
 
     // Base Case 2: The path is invalid (sum is too large or we're out of numbers).
     if (target < 0 || index >= nums.size()) {
+        ++progress.pruned;
         return; 
     }
 
+    // Cardinality pruning: no room for another item, or (for "exactly k")
+    // not enough items left to ever reach k.
+    if (current_subset.size() == max_items) {
+        ++progress.pruned;
+        return;
+    }
+    if (exact_count && nums.size() - index < max_items - current_subset.size()) {
+        ++progress.pruned;
+        return;
+    }
+
     // --- Explore ---
     // 1. Include the element at the current index.
     current_subset.push_back(nums[index]);
-    findSubsetsRecursive(nums, target - nums[index], index + 1, current_subset, result, find_all);
+    findSubsetsRecursive(nums, target - nums[index], index + 1, current_subset, result, find_all,
+                         max_items, exact_count, stop);
     
     // 2. Backtrack (remove the element) to explore the other path.
     current_subset.pop_back();
 
     // 3. Exclude the element at the current index.
-    findSubsetsRecursive(nums, target, index + 1, current_subset, result, find_all);
+    findSubsetsRecursive(nums, target, index + 1, current_subset, result, find_all,
+                         max_items, exact_count, stop);
 }
 
-SolverResult BacktrackingSolver::solve(const DataSet& data, bool find_all) {
+SolverResult BacktrackingSolver::solve(const DataSetView& data, bool find_all) {
     auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
     
+    if (data.cardinality != CardinalityRule::None && data.cardinality_k < 0) {
+        throw std::invalid_argument("Cardinality limit must be non-negative.");
+    }
+    const size_t max_items = data.cardinality == CardinalityRule::None
+        ? std::numeric_limits<size_t>::max()
+        : static_cast<size_t>(data.cardinality_k);
+    const bool exact_count = data.cardinality == CardinalityRule::Exactly;
+
     SolverResult result;
-    std::vector<int> current_subset;
+    m_currentSubset.clear();
+    m_currentSubset.reserve(data.numbers.size());
+    m_bestSubset.clear();
+    m_bestSubset.reserve(data.numbers.size());
+    m_bestGap = -1;
     
-    findSubsetsRecursive(data.numbers, data.target_sum, 0, current_subset, result, find_all);
+    findSubsetsRecursive(data.numbers, data.target_sum, 0, m_currentSubset, result, find_all,
+                         max_items, exact_count, stop);
+
+    // Stopped early without a solution: report the closest sum below the
+    // target that the search reached.
+    if (stop.stopped() && !result.solution_exists && m_bestGap >= 0) {
+        result.subsets.push_back(m_bestSubset);
+        result.achieved_sum = static_cast<long long>(data.target_sum) - m_bestGap;
+    }
+
+    result.status = stop.status();
 
     auto end_time = std::chrono::high_resolution_clock::now();
     result.execution_time = end_time - start_time;
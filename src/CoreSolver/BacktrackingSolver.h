@@ -1,13 +1,32 @@
 /// src/CoreSolver/BacktrackingSolver.h
 #pragma once
 #include "SubsetSumSolver.h"
+#include <cstddef>
+#include <vector>
 
 class BacktrackingSolver : public ISubsetSumSolver {
 public:
-    SolverResult solve(const DataSet& data, bool find_all = false) override;
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+    std::size_t workspaceBytes() const override {
+        return (m_currentSubset.capacity() + m_bestSubset.capacity()) * sizeof(int);
+    }
+    void releaseWorkspace() override {
+        std::vector<int>().swap(m_currentSubset);
+        std::vector<int>().swap(m_bestSubset);
+    }
 
 private:
-    void findSubsetsRecursive(const std::vector<int>& nums, int target, size_t index, 
+    // The path being explored, reused across solves.
+    std::vector<int> m_currentSubset;
+    // Closest admissible path below the target so far, reported when the
+    // search is stopped before finding a solution; m_bestGap is its distance
+    // to the target (negative: none yet).
+    std::vector<int> m_bestSubset;
+    long long m_bestGap = -1;
+
+    void findSubsetsRecursive(Span<const int> nums, int target, size_t index, 
                               std::vector<int>& current_subset, 
-                              SolverResult& result, bool find_all);
+                              SolverResult& result, bool find_all,
+                              size_t max_items, bool exact_count, StopCondition& stop);
 };
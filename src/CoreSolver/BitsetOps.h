@@ -0,0 +1,82 @@
+// src/CoreSolver/BitsetOps.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Word-parallel helpers for the packed reachability rows used by the DP engines.
+// A row of `bits` sums is stored little-endian in ceil(bits / 64) 64-bit words.
+namespace bitset_ops {
+
+using Word = std::uint64_t;
+constexpr std::size_t kWordBits = 64;
+
+inline std::size_t wordsFor(std::size_t bits) {
+    return (bits + kWordBits - 1) / kWordBits;
+}
+
+inline bool test(const Word* row, std::size_t bit) {
+    return (row[bit / kWordBits] >> (bit % kWordBits)) & 1u;
+}
+
+inline void set(Word* row, std::size_t bit) {
+    row[bit / kWordBits] |= Word{1} << (bit % kWordBits);
+}
+
+// dst |= src << shift over `words` words. Walks from the high word down, so
+// dst and src may alias (the in-place "row |= row << w" knapsack update).
+inline void shiftOr(Word* dst, const Word* src, std::size_t words, std::size_t shift) {
+    const std::size_t word_shift = shift / kWordBits;
+    const std::size_t bit_shift = shift % kWordBits;
+    if (word_shift >= words) return;
+    for (std::size_t i = words; i-- > word_shift;) {
+        Word moved = src[i - word_shift] << bit_shift;
+        if (bit_shift != 0 && i > word_shift) {
+            moved |= src[i - word_shift - 1] >> (kWordBits - bit_shift);
+        }
+        dst[i] |= moved;
+    }
+}
+
+// Index of the lowest set bit; `word` must be non-zero.
+inline int lowestBit(Word word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// Index of the highest set bit; `word` must be non-zero.
+inline int highestBit(Word word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return static_cast<int>(index);
+#else
+    return static_cast<int>(kWordBits) - 1 - __builtin_clzll(word);
+#endif
+}
+
+// Highest set bit of a whole row, or -1 if the row is empty.
+inline long long highestSet(const Word* row, std::size_t words) {
+    for (std::size_t i = words; i-- > 0;) {
+        if (row[i] != 0) return static_cast<long long>(i * kWordBits) + highestBit(row[i]);
+    }
+    return -1;
+}
+
+// Clears the padding bits above `bits` in the last word so they never leak
+// into population counts or reconstruction.
+inline void maskTail(Word* row, std::size_t bits) {
+    const std::size_t rem = bits % kWordBits;
+    if (rem != 0) row[bits / kWordBits] &= (Word{1} << rem) - 1;
+}
+
+} // namespace bitset_ops
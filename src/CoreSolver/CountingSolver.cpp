@@ -0,0 +1,180 @@
+// src/CoreSolver/CountingSolver.cpp
+#include "CountingSolver.h"
+#include "BitsetOps.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string countExact64(Span<const int> nums, std::size_t span, StopCondition& stop) {
+    std::vector<std::uint64_t> count(span, 0);
+    count[0] = 1;
+    for (int w : nums) {
+        ++stop.progress().steps_done;
+        const std::size_t shift = static_cast<std::size_t>(w);
+        if (shift >= span) continue;
+        if (stop.shouldStop(span)) return {};
+        for (std::size_t s = span - 1; s >= shift; --s) {
+            const std::uint64_t add = count[s - shift];
+            if (add > std::numeric_limits<std::uint64_t>::max() - count[s]) {
+                throw std::overflow_error("Subset count exceeds 64 bits. Use the 'big' or 'mod' count mode instead.");
+            }
+            count[s] += add;
+            if (s == 0) break;
+        }
+    }
+    return std::to_string(count[span - 1]);
+}
+
+std::string countModular(Span<const int> nums, std::size_t span, std::uint64_t modulus, bool& reachable,
+                         StopCondition& stop) {
+    std::vector<std::uint64_t> count(span, 0);
+    count[0] = 1 % modulus;
+    // A count of 0 (mod m) does not mean "no subset", so reachability is
+    // tracked separately with a bitset.
+    const std::size_t words = bitset_ops::wordsFor(span);
+    std::vector<bitset_ops::Word> row(words, 0);
+    bitset_ops::set(row.data(), 0);
+    for (int w : nums) {
+        ++stop.progress().steps_done;
+        const std::size_t shift = static_cast<std::size_t>(w);
+        if (shift >= span) continue;
+        if (stop.shouldStop(span)) return {};
+        for (std::size_t s = span - 1; s >= shift; --s) {
+            std::uint64_t sum = count[s] + count[s - shift];
+            if (sum >= modulus) sum -= modulus;
+            count[s] = sum;
+            if (s == 0) break;
+        }
+        bitset_ops::shiftOr(row.data(), row.data(), words, shift);
+    }
+    reachable = bitset_ops::test(row.data(), span - 1);
+    return std::to_string(count[span - 1]);
+}
+
+// Renders a little-endian base-2^64 number in decimal.
+std::string limbsToDecimal(std::vector<std::uint64_t> limbs) {
+    std::vector<std::uint32_t> parts;  // little-endian base-2^32
+    for (std::uint64_t limb : limbs) {
+        parts.push_back(static_cast<std::uint32_t>(limb));
+        parts.push_back(static_cast<std::uint32_t>(limb >> 32));
+    }
+    while (!parts.empty() && parts.back() == 0) parts.pop_back();
+    if (parts.empty()) return "0";
+
+    std::vector<std::uint32_t> chunks;  // base-10^9 digits, least significant first
+    while (!parts.empty()) {
+        std::uint64_t rem = 0;
+        for (std::size_t k = parts.size(); k-- > 0;) {
+            const std::uint64_t cur = (rem << 32) | parts[k];
+            parts[k] = static_cast<std::uint32_t>(cur / 1000000000u);
+            rem = cur % 1000000000u;
+        }
+        chunks.push_back(static_cast<std::uint32_t>(rem));
+        while (!parts.empty() && parts.back() == 0) parts.pop_back();
+    }
+    std::string out = std::to_string(chunks.back());
+    for (std::size_t k = chunks.size() - 1; k-- > 0;) {
+        std::string digits = std::to_string(chunks[k]);
+        out += std::string(9 - digits.size(), '0') + digits;
+    }
+    return out;
+}
+
+std::string countBig(Span<const int> nums, std::size_t span, StopCondition& stop) {
+    // After k contributing items every count is at most 2^k, so k / 64 + 1
+    // limbs always suffice; the table is widened only when k crosses a limb.
+    std::size_t limbs = 1;
+    std::vector<std::uint64_t> count(span * limbs, 0);
+    count[0] = 1;
+    std::size_t contributing = 0;
+    for (int w : nums) {
+        ++stop.progress().steps_done;
+        const std::size_t shift = static_cast<std::size_t>(w);
+        if (shift >= span) continue;
+        if (stop.shouldStop(span)) return {};
+        ++contributing;
+        if (contributing / 64 + 1 > limbs) {
+            const std::size_t wider = limbs * 2;
+            std::vector<std::uint64_t> grown(span * wider, 0);
+            for (std::size_t s = 0; s < span; ++s) {
+                std::copy_n(&count[s * limbs], limbs, &grown[s * wider]);
+            }
+            count.swap(grown);
+            limbs = wider;
+        }
+        for (std::size_t s = span - 1; s >= shift; --s) {
+            std::uint64_t* dst = &count[s * limbs];
+            const std::uint64_t* src = &count[(s - shift) * limbs];
+            std::uint64_t carry = 0;
+            for (std::size_t k = 0; k < limbs; ++k) {
+                // Read before writing: a zero-weight item makes src and dst the same cell.
+                const std::uint64_t add = src[k];
+                const std::uint64_t partial = dst[k] + carry;
+                carry = partial < carry ? 1 : 0;
+                dst[k] = partial + add;
+                carry += dst[k] < add ? 1 : 0;
+            }
+            if (s == 0) break;
+        }
+    }
+    return limbsToDecimal(std::vector<std::uint64_t>(count.end() - static_cast<std::ptrdiff_t>(limbs), count.end()));
+}
+
+} // namespace
+
+CountingSolver::CountingSolver(CountMode mode, std::uint64_t modulus)
+    : m_mode(mode), m_modulus(modulus) {
+    if (m_mode == CountMode::Modular && (m_modulus == 0 || m_modulus > (std::uint64_t{1} << 63))) {
+        throw std::invalid_argument("Counting modulus must be between 1 and 2^63.");
+    }
+}
+
+SolverResult CountingSolver::solve(const DataSetView& data, bool find_all) {
+    if (find_all) {
+        throw std::logic_error("Counting solver does not enumerate subsets. Use the 'backtrack' algorithm with 'find all' instead.");
+    }
+    if (data.cardinality != CardinalityRule::None) {
+        throw std::logic_error("Counting solver does not support cardinality constraints. Use the 'dp' algorithm with 'find all' instead.");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+
+    for (int w : data.numbers) {
+        if (w < 0) throw std::invalid_argument("Counting solver requires non-negative numbers.");
+    }
+
+    SolverResult result;
+    if (data.target_sum < 0) {
+        result.solution_count = "0";
+    } else {
+        const std::size_t span = static_cast<std::size_t>(data.target_sum) + 1;
+        stop.progress().steps_total = data.numbers.size();
+        switch (m_mode) {
+        case CountMode::Exact64:
+            result.solution_count = countExact64(data.numbers, span, stop);
+            result.solution_exists = !result.solution_count.empty() && result.solution_count != "0";
+            break;
+        case CountMode::Modular:
+            result.solution_count = countModular(data.numbers, span, m_modulus, result.solution_exists, stop);
+            if (!stop.stopped()) result.count_modulus = m_modulus;
+            break;
+        case CountMode::BigInt:
+            result.solution_count = countBig(data.numbers, span, stop);
+            result.solution_exists = !result.solution_count.empty() && result.solution_count != "0";
+            break;
+        }
+    }
+
+    // A partial count is meaningless, so a stopped solve reports none.
+    result.status = stop.status();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
@@ -0,0 +1,25 @@
+// src/CoreSolver/CountingSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include <cstdint>
+
+// How the counting DP stores its per-sum counters.
+enum class CountMode {
+    Exact64,  // 64-bit counters; throws std::overflow_error if a count does not fit
+    Modular,  // counts reduced modulo a user-supplied modulus
+    BigInt    // arbitrary precision, limbs grown as the item count requires
+};
+
+// Counts the subsets (by position, so duplicates count separately) that sum
+// to the target with a 1D counting DP in O(n * target) time. Only the count
+// is returned, in SolverResult::solution_count; no subsets are materialized.
+class CountingSolver : public ISubsetSumSolver {
+public:
+    explicit CountingSolver(CountMode mode = CountMode::Exact64, std::uint64_t modulus = 1000000007ULL);
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+private:
+    CountMode m_mode;
+    std::uint64_t m_modulus;
+};
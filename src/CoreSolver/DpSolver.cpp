@@ -1,46 +1,239 @@
 // src/CoreSolver/DpSolver.cpp
 #include "DpSolver.h"
+#include "BitsetOps.h"
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include <chrono>
 #include <stdexcept>
 
-SolverResult DpSolver::solve(const DataSet& data, bool find_all) {
-    if (find_all) {
-        throw std::logic_error("DP solver does not support 'find all' mode. Use the 'backtrack' algorithm instead.");
+namespace {
+
+// Enumeration state: one frame per table row on the current path.
+struct Frame {
+    int i;
+    int c;
+    int sum;
+    int stage;  // 0: try including nums[i-1], 1: try excluding it, 2: done
+};
+
+// Row (i, c) of the table is a packed bitset of the sums reachable with the
+// first i numbers, so the table costs one bit per cell. Without a cardinality
+// rule there is a single layer (c = 0). With one, layer c holds the sums
+// reachable using exactly c of those numbers, for c = 0..k.
+// The bits live in the solver's workspace.
+struct ReachTable {
+    std::size_t words;
+    int layers;
+    bool counted;
+    bitset_ops::Word* bits;
+
+    bitset_ops::Word* row(int i, int c) {
+        return bits + (static_cast<std::size_t>(i) * layers + c) * words;
+    }
+    const bitset_ops::Word* row(int i, int c) const {
+        return bits + (static_cast<std::size_t>(i) * layers + c) * words;
+    }
+    bool reachable(int i, int c, int sum) const {
+        return bitset_ops::test(row(i, c), static_cast<std::size_t>(sum));
+    }
+    // Layer reached from (i, c) by including an item, or -1 if none is left.
+    int layerBefore(int c) const { return counted ? c - 1 : c; }
+};
+
+// Rebuilds one subset reaching `sum` in `layer` using the first `rows` numbers.
+void reconstruct(const ReachTable& dp, Span<const int> nums, int rows, int layer, int sum, std::vector<int>& subset) {
+    subset.clear();
+    int c = layer;
+    for (int i = rows; i > 0 && (sum > 0 || c > 0); --i) {
+        if (!dp.reachable(i - 1, c, sum)) {
+            subset.push_back(nums[i - 1]);
+            sum -= nums[i - 1];
+            c = dp.layerBefore(c);
+        }
+    }
+}
+
+// Walks the table backwards from (rows, layer, target). A cell is only entered
+// when it is reachable from (0, 0, 0), and it was reached from the target
+// cell, so every branch taken ends in a solution: the search never enters a
+// dead state and the delay between consecutive solutions is O(n).
+// `chosen` holds the item indices on the current path, highest first.
+void enumerateAll(const ReachTable& dp, Span<const int> nums, int rows, int layer, int target,
+                  SolverResult& result, StopCondition& stop, std::vector<Frame>& stack,
+                  std::vector<int>& chosen, std::vector<int>& subset) {
+    stack.assign(1, Frame{rows, layer, target, 0});
+    chosen.clear();
+
+    while (!stack.empty() && !stop.shouldStop()) {
+        Frame& top = stack.back();
+        if (top.i == 0) {
+            subset.clear();
+            for (auto it = chosen.rbegin(); it != chosen.rend(); ++it) subset.push_back(nums[*it]);
+            stop.foundSolution(subset);
+            if (stop.retainSolutions()) result.subsets.push_back(subset);
+            stack.pop_back();
+            continue;
+        }
+
+        const int i = top.i;
+        const int c = top.c;
+        const int sum = top.sum;
+        const int w = nums[i - 1];
+        if (top.stage == 0) {
+            top.stage = 1;
+            const int prev_layer = dp.layerBefore(c);
+            if (w <= sum && prev_layer >= 0 && dp.reachable(i - 1, prev_layer, sum - w)) {
+                chosen.push_back(i - 1);
+                stack.push_back({i - 1, prev_layer, sum - w, 0});
+            }
+        } else if (top.stage == 1) {
+            // Returning from the include branch (if it was taken) undoes its choice.
+            if (!chosen.empty() && chosen.back() == i - 1) chosen.pop_back();
+            top.stage = 2;
+            if (dp.reachable(i - 1, c, sum)) {
+                stack.push_back({i - 1, c, sum, 0});
+            }
+        } else {
+            stack.pop_back();
+        }
     }
+}
+
+} // namespace
+
+// Capacities only grow: assign() and clear() keep them, so once a solve of
+// the largest shape has run, the next ones allocate nothing here.
+struct DpSolver::Workspace {
+    std::vector<bitset_ops::Word> table;
+    std::vector<Frame> stack;
+    std::vector<int> chosen;
+    std::vector<int> subset;
+};
 
+DpSolver::DpSolver() : m_workspace(std::make_unique<Workspace>()) {}
+
+DpSolver::~DpSolver() = default;
+
+std::size_t DpSolver::workspaceBytes() const {
+    const Workspace& ws = *m_workspace;
+    return ws.table.capacity() * sizeof(bitset_ops::Word) + ws.stack.capacity() * sizeof(Frame) +
+           (ws.chosen.capacity() + ws.subset.capacity()) * sizeof(int);
+}
+
+void DpSolver::releaseWorkspace() {
+    m_workspace = std::make_unique<Workspace>();
+}
+
+SolverResult DpSolver::solve(const DataSetView& data, bool find_all) {
     auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+    PhaseTimer preprocess = stop.time(SolvePhase::Preprocess);
     
     const auto& nums = data.numbers;
     int target = data.target_sum;
     int n = nums.size();
+    for (int w : nums) {
+        if (w < 0) throw std::invalid_argument("DP solver requires non-negative numbers.");
+    }
+    if (data.cardinality != CardinalityRule::None && data.cardinality_k < 0) {
+        throw std::invalid_argument("Cardinality limit must be non-negative.");
+    }
+
+    SolverResult result;
+    const bool counted = data.cardinality != CardinalityRule::None;
+    const int max_items = counted ? std::min(data.cardinality_k, n) : 0;
+    const bool impossible = data.cardinality == CardinalityRule::Exactly && data.cardinality_k > n;
+    preprocess.stop();
+    if (target < 0 || impossible) {
+        result.phases = stop.phaseTimes();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        result.execution_time = end_time - start_time;
+        return result;
+    }
+
+    const std::size_t span = static_cast<std::size_t>(target) + 1;
+    PhaseTimer allocate = stop.time(SolvePhase::Allocate);
+    Workspace& ws = *m_workspace;
+    ReachTable dp{bitset_ops::wordsFor(span), max_items + 1, counted, nullptr};
+    ws.table.assign(static_cast<std::size_t>(n + 1) * dp.layers * dp.words, 0);
+    dp.bits = ws.table.data();
+    bitset_ops::set(dp.row(0, 0), 0);
+    allocate.stop();
 
-    std::vector<std::vector<bool>> dp(n + 1, std::vector<bool>(target + 1, false));
-    for (int i = 0; i <= n; ++i) dp[i][0] = true;
+    // Layers whose subsets satisfy the cardinality rule.
+    const int first_layer = data.cardinality == CardinalityRule::Exactly ? max_items : 0;
+    auto target_reached = [&](int rows) {
+        for (int layer = first_layer; layer < dp.layers; ++layer) {
+            if (dp.reachable(rows, layer, target)) return true;
+        }
+        return false;
+    };
 
-    for (int i = 1; i <= n; ++i) {
-        for (int j = 1; j <= target; ++j) {
-            if (nums[i - 1] > j) {
-                dp[i][j] = dp[i - 1][j];
-            } else {
-                dp[i][j] = dp[i - 1][j] || dp[i - 1][j - nums[i - 1]];
+    // (count, sum) update: row(i, c) = row(i-1, c) | row(i-1, c-1) << w, one
+    // word at a time. Without a cardinality rule both terms use layer 0.
+    // A single solution only needs the rows up to the first one that reaches
+    // the target; a stop request ends the fill with rows [0, rows] valid.
+    int rows = 0;
+    stop.progress().steps_total = static_cast<std::uint64_t>(n);
+    PhaseTimer fill = stop.time(SolvePhase::Fill);
+    while (rows < n && (find_all || !target_reached(rows))) {
+        if (stop.shouldStop(dp.words * static_cast<std::size_t>(dp.layers))) break;
+        const int i = ++rows;
+        stop.progress().steps_done = static_cast<std::uint64_t>(i);
+        const std::size_t w = static_cast<std::size_t>(nums[i - 1]);
+        for (int c = 0; c < dp.layers; ++c) {
+            bitset_ops::Word* cur = dp.row(i, c);
+            const bitset_ops::Word* prev = dp.row(i - 1, c);
+            std::copy(prev, prev + dp.words, cur);
+            const int from = dp.layerBefore(c);
+            if (from >= 0 && from < i) {
+                bitset_ops::shiftOr(cur, dp.row(i - 1, from), dp.words, w);
+                bitset_ops::maskTail(cur, span);
             }
         }
     }
-    
-    SolverResult result;
-    if (dp[n][target]) {
+    fill.stop();
+
+    for (int layer = first_layer; layer < dp.layers && !stop.stopped(); ++layer) {
+        if (!dp.reachable(rows, layer, target)) continue;
         result.solution_exists = true;
-        std::vector<int> subset;
-        int curr_sum = target;
-        for (int i = n; i > 0 && curr_sum > 0; --i) {
-            if (dp[i][curr_sum] && !dp[i - 1][curr_sum]) {
-                subset.push_back(nums[i - 1]);
-                curr_sum -= nums[i - 1];
+        if (find_all) {
+            PhaseTimer enumerate = stop.time(SolvePhase::Reconstruct);
+            enumerateAll(dp, nums, rows, layer, target, result, stop, ws.stack, ws.chosen, ws.subset);
+            continue;
+        }
+        PhaseTimer walk = stop.time(SolvePhase::Reconstruct);
+        reconstruct(dp, nums, rows, layer, target, ws.subset);
+        walk.stop();
+        PhaseTimer output = stop.time(SolvePhase::Output);
+        stop.foundSolution(ws.subset);
+        if (stop.retainSolutions()) result.subsets.push_back(ws.subset);
+        break;
+    }
+
+    // Stopped early without a solution: report the closest sum below the
+    // target that the processed rows can reach.
+    if (stop.stopped() && !result.solution_exists) {
+        PhaseTimer walk = stop.time(SolvePhase::Reconstruct);
+        long long best_sum = -1;
+        int best_layer = first_layer;
+        for (int layer = first_layer; layer < dp.layers; ++layer) {
+            const long long sum = bitset_ops::highestSet(dp.row(rows, layer), dp.words);
+            if (sum > best_sum) {
+                best_sum = sum;
+                best_layer = layer;
             }
         }
-        result.subsets.push_back(subset);
+        if (best_sum >= 0) {
+            reconstruct(dp, nums, rows, best_layer, static_cast<int>(best_sum), ws.subset);
+            result.subsets.push_back(ws.subset);
+            result.achieved_sum = best_sum;
+            result.solution_exists = best_sum == target;
+        }
     }
+    result.status = stop.status();
+    result.phases = stop.phaseTimes();
 
     auto end_time = std::chrono::high_resolution_clock::now();
     result.execution_time = end_time - start_time;
@@ -1,8 +1,20 @@
 // src/CoreSolver/DpSolver.h
 #pragma once
 #include "SubsetSumSolver.h"
+#include <memory>
 
 class DpSolver : public ISubsetSumSolver {
 public:
-    SolverResult solve(const DataSet& data, bool find_all = false) override;
+    DpSolver();
+    ~DpSolver() override;
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+    std::size_t workspaceBytes() const override;
+    void releaseWorkspace() override;
+
+private:
+    // Reachability table and enumeration buffers, reused across solves.
+    struct Workspace;
+    std::unique_ptr<Workspace> m_workspace;
 };
@@ -0,0 +1,204 @@
+// src/CoreSolver/GreedySolver.cpp
+#include "GreedySolver.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One local-search run over a fixed item order. `in` and `out` hold item
+// indices; `out` is kept sorted by value so the best partner for a swap can
+// be found by binary search.
+class LocalSearch {
+public:
+    LocalSearch(Span<const int> nums, long long target) : m_nums(nums), m_target(target) {}
+
+    // Greedy fill in the given order, then swap moves until none improves.
+    long long run(const std::vector<int>& order, Clock::time_point deadline, StopCondition& stop) {
+        m_in.clear();
+        m_out.clear();
+        m_sum = 0;
+        for (int index : order) {
+            if (m_sum + m_nums[index] <= m_target) {
+                m_in.push_back(index);
+                m_sum += m_nums[index];
+            } else {
+                m_out.push_back(index);
+            }
+        }
+        std::sort(m_out.begin(), m_out.end(), [&](int a, int b) { return m_nums[a] < m_nums[b]; });
+        while (m_sum < m_target && Clock::now() < deadline && !stop.shouldStop(m_in.size() + m_out.size()) && improve()) {}
+        return m_sum;
+    }
+
+    std::vector<int> chosen() const {
+        std::vector<int> sorted = m_in;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+
+private:
+    // Position in m_out of the largest value <= limit, or -1.
+    long largestAtMost(long long limit) const {
+        auto it = std::upper_bound(m_out.begin(), m_out.end(), limit,
+                                   [&](long long value, int index) { return value < m_nums[index]; });
+        return static_cast<long>(it - m_out.begin()) - 1;
+    }
+
+    void moveOut(std::size_t in_pos) {
+        const int index = m_in[in_pos];
+        m_sum -= m_nums[index];
+        m_in.erase(m_in.begin() + static_cast<long>(in_pos));
+        auto it = std::lower_bound(m_out.begin(), m_out.end(), index,
+                                   [&](int a, int b) { return m_nums[a] < m_nums[b]; });
+        m_out.insert(it, index);
+    }
+
+    void moveIn(std::vector<long> out_positions) {
+        std::sort(out_positions.rbegin(), out_positions.rend());
+        for (long pos : out_positions) {
+            m_in.push_back(m_out[pos]);
+            m_sum += m_nums[m_out[pos]];
+            m_out.erase(m_out.begin() + pos);
+        }
+    }
+
+    // Applies the first move that brings the sum closer to the target.
+    bool improve() {
+        const long long gap = m_target - m_sum;
+
+        // Fill: add the largest unchosen number that still fits.
+        long best = largestAtMost(gap);
+        if (best >= 0 && m_nums[m_out[best]] > 0) {
+            moveIn({best});
+            return true;
+        }
+
+        // 1-1 swap: replace a with the largest b <= gap + a, if b > a.
+        for (std::size_t i = 0; i < m_in.size(); ++i) {
+            const int a = m_nums[m_in[i]];
+            long pos = largestAtMost(gap + a);
+            if (pos >= 0 && m_nums[m_out[pos]] > a) {
+                moveIn({pos});
+                moveOut(i);
+                return true;
+            }
+        }
+
+        // 1-2 swap: replace a with the best pair b1 + b2 <= gap + a (two pointers).
+        for (std::size_t i = 0; i < m_in.size(); ++i) {
+            const long long limit = gap + m_nums[m_in[i]];
+            long lo = 0, hi = static_cast<long>(m_out.size()) - 1, best_lo = -1, best_hi = -1;
+            long long best_pair = m_nums[m_in[i]];
+            while (lo < hi) {
+                const long long pair = static_cast<long long>(m_nums[m_out[lo]]) + m_nums[m_out[hi]];
+                if (pair > limit) {
+                    --hi;
+                } else {
+                    if (pair > best_pair) { best_pair = pair; best_lo = lo; best_hi = hi; }
+                    ++lo;
+                }
+            }
+            if (best_lo >= 0) {
+                moveIn({best_lo, best_hi});
+                moveOut(i);
+                return true;
+            }
+        }
+
+        // 2-1 swap: replace a1 + a2 with the largest b <= gap + a1 + a2.
+        for (std::size_t i = 0; i < m_in.size(); ++i) {
+            for (std::size_t j = i + 1; j < m_in.size(); ++j) {
+                const long long pair = static_cast<long long>(m_nums[m_in[i]]) + m_nums[m_in[j]];
+                long pos = largestAtMost(gap + pair);
+                if (pos >= 0 && m_nums[m_out[pos]] > pair) {
+                    moveIn({pos});
+                    moveOut(j);
+                    moveOut(i);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    Span<const int> m_nums;
+    long long m_target;
+    std::vector<int> m_in, m_out;
+    long long m_sum = 0;
+};
+
+} // namespace
+
+GreedySolver::GreedySolver(std::chrono::milliseconds time_budget, unsigned seed)
+    : m_timeBudget(time_budget), m_seed(seed) {}
+
+SolverResult GreedySolver::solve(const DataSetView& data, bool find_all) {
+    if (find_all) {
+        throw std::logic_error("Greedy solver does not support 'find all' mode.");
+    }
+    if (data.cardinality != CardinalityRule::None) {
+        throw std::logic_error("Greedy solver does not support cardinality constraints.");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+    const Clock::time_point deadline = Clock::now() + m_timeBudget;
+
+    const auto& nums = data.numbers;
+    for (int w : nums) {
+        if (w < 0) throw std::invalid_argument("Greedy solver requires non-negative numbers.");
+    }
+
+    SolverResult result;
+    if (data.target_sum >= 0) {
+        LocalSearch search(nums, data.target_sum);
+        std::vector<int> order(nums.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return nums[a] > nums[b]; });
+
+        long long best_sum = search.run(order, deadline, stop);
+        std::vector<int> best = search.chosen();
+        // One step per local search run; restarts have no fixed total.
+        SolveProgress& progress = stop.progress();
+        progress.steps_done = 1;
+        progress.offerGap(data.target_sum - best_sum);
+
+        // Randomized restarts: greedy fill in a shuffled order, then local search.
+        std::mt19937 rng(m_seed);
+        int stale = 0;
+        while (best_sum < data.target_sum && !nums.empty() && stale < kMaxStaleRestarts && Clock::now() < deadline &&
+               !stop.shouldStop(nums.size())) {
+            std::shuffle(order.begin(), order.end(), rng);
+            const long long sum = search.run(order, deadline, stop);
+            ++progress.steps_done;
+            progress.offerGap(data.target_sum - sum);
+            if (sum > best_sum) {
+                best_sum = sum;
+                best = search.chosen();
+                stale = 0;
+            } else {
+                ++stale;
+            }
+        }
+
+        std::vector<int> subset;
+        for (int index : best) subset.push_back(nums[index]);
+        result.solution_exists = true;
+        result.subsets.push_back(subset);
+        result.achieved_sum = best_sum;
+    }
+
+    // Running out of the heuristic's own budget is a normal finish; only the
+    // caller's timeout or cancellation is reported as a status.
+    result.status = stop.status();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
@@ -0,0 +1,23 @@
+// src/CoreSolver/GreedySolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include <chrono>
+
+// Heuristic subset sum: a largest-first greedy fill, improved by local search
+// (fill, 1-1, 1-2 and 2-1 swaps between chosen and unchosen numbers), then
+// randomized restarts until the target is hit, kMaxStaleRestarts restarts in
+// a row bring no improvement, or the wall-clock budget runs out. Returns the closest allocation found that stays within the target;
+// it never proves that a better one does not exist.
+class GreedySolver : public ISubsetSumSolver {
+public:
+    static constexpr int kMaxStaleRestarts = 64;
+
+    explicit GreedySolver(std::chrono::milliseconds time_budget = std::chrono::milliseconds(1),
+                          unsigned seed = 1);
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+private:
+    std::chrono::milliseconds m_timeBudget;
+    unsigned m_seed;
+};
@@ -0,0 +1,104 @@
+// src/CoreSolver/HybridSolver.cpp
+#include "HybridSolver.h"
+#include "GreedySolver.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct BoundedSearch {
+    const std::vector<int>& sorted;        // numbers, largest first
+    std::vector<long long> suffix;         // suffix[i]: sum of sorted[i..]
+    long long target;
+    Clock::time_point deadline;
+    StopCondition& stop;
+    long long best_sum;
+    std::vector<int> best_path;            // positions in `sorted`
+    std::vector<int> path;
+    std::size_t nodes = 0;
+    bool timed_out = false;
+
+    BoundedSearch(const std::vector<int>& items, long long goal, Clock::time_point until, StopCondition& stop_condition,
+                  long long incumbent)
+        : sorted(items), suffix(items.size() + 1, 0), target(goal), deadline(until), stop(stop_condition),
+          best_sum(incumbent) {
+        for (std::size_t i = items.size(); i-- > 0;) suffix[i] = suffix[i + 1] + items[i];
+    }
+
+    bool done() const { return timed_out || best_sum == target; }
+
+    // Exclusion is the loop step, so recursion depth is bounded by the size
+    // of the subset being built.
+    void branch(std::size_t i, long long sum) {
+        SolveProgress& progress = stop.progress();
+        ++progress.nodes;
+        if (sum > best_sum) {
+            best_sum = sum;
+            best_path = path;
+            progress.offerGap(target - best_sum);
+        }
+        for (; i < sorted.size() && !done(); ++i) {
+            if (stop.shouldStop() || ((++nodes & 4095) == 0 && Clock::now() >= deadline)) {
+                timed_out = true;
+                return;
+            }
+            if (sum + suffix[i] <= best_sum) {
+                ++progress.pruned;
+                return;
+            }
+            if (sum + sorted[i] <= target) {
+                path.push_back(static_cast<int>(i));
+                branch(i + 1, sum + sorted[i]);
+                path.pop_back();
+            }
+        }
+    }
+};
+
+} // namespace
+
+HybridSolver::HybridSolver(std::chrono::milliseconds time_budget, unsigned seed)
+    : m_timeBudget(time_budget), m_seed(seed) {}
+
+SolverResult HybridSolver::solve(const DataSetView& data, bool find_all) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const Clock::time_point deadline = Clock::now() + m_timeBudget;
+    StopCondition stop = makeStopCondition();
+
+    // The greedy engine validates the input and supplies the incumbent.
+    GreedySolver greedy(m_timeBudget / 10, m_seed);
+    shareStopConditions(greedy);
+    SolverResult result = greedy.solve(data, find_all);
+
+    if (result.solution_exists && *result.achieved_sum < data.target_sum) {
+        std::vector<int> sorted;
+        for (int w : data.numbers) {
+            if (w > 0 && w <= data.target_sum) sorted.push_back(w);
+        }
+        std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+        BoundedSearch search(sorted, data.target_sum, deadline, stop, *result.achieved_sum);
+        stop.progress().offerGap(data.target_sum - *result.achieved_sum);
+        search.branch(0, 0);
+
+        if (search.best_sum > *result.achieved_sum) {
+            std::vector<int> subset;
+            for (int position : search.best_path) subset.push_back(sorted[position]);
+            result.subsets.assign(1, subset);
+            result.achieved_sum = search.best_sum;
+        }
+        if (!search.timed_out) result.optimum_upper_bound = search.best_sum;
+        if (stop.stopped()) result.status = stop.status();
+    } else if (result.solution_exists && result.status == SolveStatus::Completed) {
+        result.optimum_upper_bound = result.achieved_sum;
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
@@ -0,0 +1,23 @@
+// src/CoreSolver/HybridSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include <chrono>
+
+// Heuristic-seeded exact search. The greedy/local-search engine runs first
+// (with a tenth of the budget) and its best sum becomes the incumbent of a
+// depth-first branch and bound that maximizes the sum within the target,
+// pruning any branch whose remaining numbers cannot beat the incumbent. If
+// the search finishes inside the wall-clock budget the answer is proven
+// optimal (reported through optimum_upper_bound); otherwise the best
+// allocation found so far is returned.
+class HybridSolver : public ISubsetSumSolver {
+public:
+    explicit HybridSolver(std::chrono::milliseconds time_budget = std::chrono::milliseconds(1000),
+                          unsigned seed = 1);
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+private:
+    std::chrono::milliseconds m_timeBudget;
+    unsigned m_seed;
+};
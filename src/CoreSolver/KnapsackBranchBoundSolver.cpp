@@ -0,0 +1,88 @@
+// src/CoreSolver/KnapsackBranchBoundSolver.cpp
+#include "KnapsackBranchBoundSolver.h"
+#include "KnapsackCommon.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+struct BranchAndBound {
+    const std::vector<KnapsackItem>& items;
+    long long capacity;
+    StopCondition& stop;
+    std::vector<long long> prefix_weight;  // prefix_weight[i]: weight of items[0, i)
+    std::vector<long long> prefix_value;
+    long long best_value = 0;
+    std::vector<int> best_set;  // positions in `items`
+    std::vector<int> path;
+
+    BranchAndBound(const std::vector<KnapsackItem>& sorted, long long cap, StopCondition& stop_condition)
+        : items(sorted), capacity(cap), stop(stop_condition), prefix_weight(sorted.size() + 1, 0),
+          prefix_value(sorted.size() + 1, 0) {
+        for (size_t i = 0; i < items.size(); ++i) {
+            prefix_weight[i + 1] = prefix_weight[i] + items[i].weight;
+            prefix_value[i + 1] = prefix_value[i] + items[i].value;
+        }
+    }
+
+    // Dantzig bound for completing a partial solution with items[i..]: take
+    // whole items in efficiency order, then the fitting fraction of the first
+    // one that overflows. True if that bound can still beat the incumbent.
+    bool canImprove(size_t i, long long weight, long long value) const {
+        const long long limit = prefix_weight[i] + (capacity - weight);
+        const size_t j = static_cast<size_t>(
+            std::upper_bound(prefix_weight.begin() + i, prefix_weight.end(), limit) - prefix_weight.begin() - 1);
+        const long long whole = value + prefix_value[j] - prefix_value[i];
+        if (j == items.size()) return whole > best_value;
+        return reachesBound(whole, limit - prefix_weight[j], items[j].value, items[j].weight, best_value + 1);
+    }
+
+    // Excluding an item is the loop step, so recursion depth is bounded by
+    // the number of items in a solution. The first dive is the greedy fill.
+    void branch(size_t i, long long weight, long long value) {
+        ++stop.progress().nodes;
+        if (value > best_value) {
+            best_value = value;
+            best_set = path;
+        }
+        for (; i < items.size(); ++i) {
+            if (stop.shouldStop()) return;
+            if (!canImprove(i, weight, value)) {
+                ++stop.progress().pruned;
+                return;
+            }
+            if (weight + items[i].weight <= capacity) {
+                path.push_back(static_cast<int>(i));
+                branch(i + 1, weight + items[i].weight, value + items[i].value);
+                path.pop_back();
+            }
+        }
+    }
+};
+
+} // namespace
+
+SolverResult KnapsackBranchBoundSolver::solve(const DataSetView& data, bool find_all) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+
+    std::vector<KnapsackItem> items = loadKnapsackItems(data, find_all, "Knapsack branch-and-bound solver");
+
+    SolverResult result;
+    if (data.target_sum >= 0) {
+        sortByEfficiency(items);
+        BranchAndBound search(items, data.target_sum, stop);
+        search.branch(0, 0, 0);
+
+        std::vector<int> chosen;
+        for (int position : search.best_set) chosen.push_back(items[position].index);
+        fillKnapsackResult(data, chosen, result);
+    }
+
+    result.status = stop.status();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
@@ -0,0 +1,11 @@
+// src/CoreSolver/KnapsackBranchBoundSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+
+// 0/1 knapsack by depth-first branch and bound over items sorted by
+// efficiency, pruned with the Dantzig (LP relaxation) upper bound. Time does
+// not depend on the budget, so it suits large budgets with moderate n.
+class KnapsackBranchBoundSolver : public ISubsetSumSolver {
+public:
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+};
@@ -0,0 +1,69 @@
+// src/CoreSolver/KnapsackCommon.cpp
+#include "KnapsackCommon.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 Wide;  // __extension__ keeps -pedantic quiet
+#else
+using Wide = long double;
+#endif
+
+} // namespace
+
+std::vector<KnapsackItem> loadKnapsackItems(const DataSetView& data, bool find_all, const char* solver_name) {
+    const std::string name(solver_name);
+    if (find_all) {
+        throw std::logic_error(name + " does not support 'find all' mode.");
+    }
+    if (data.cardinality != CardinalityRule::None) {
+        throw std::logic_error(name + " does not support cardinality constraints.");
+    }
+    if (data.values.size() != data.numbers.size()) {
+        throw std::invalid_argument(name + " requires exactly one value per number.");
+    }
+
+    std::vector<KnapsackItem> items;
+    items.reserve(data.numbers.size());
+    for (size_t i = 0; i < data.numbers.size(); ++i) {
+        if (data.numbers[i] < 0 || data.values[i] < 0) {
+            throw std::invalid_argument(name + " requires non-negative numbers and values.");
+        }
+        // Zero-value items never improve an allocation, so they are dropped.
+        if (data.numbers[i] <= data.target_sum && data.values[i] > 0) {
+            items.push_back({data.numbers[i], data.values[i], static_cast<int>(i)});
+        }
+    }
+    return items;
+}
+
+void sortByEfficiency(std::vector<KnapsackItem>& items) {
+    std::stable_sort(items.begin(), items.end(), [](const KnapsackItem& a, const KnapsackItem& b) {
+        // a.value / a.weight > b.value / b.weight, with zero weights first.
+        return a.value * b.weight > b.value * a.weight;
+    });
+}
+
+bool reachesBound(long long a, long long b, long long num, long long den, long long bound) {
+    // a + b * num / den >= bound  <=>  (a - bound) * den + b * num >= 0  (den > 0)
+    return static_cast<Wide>(a - bound) * den + static_cast<Wide>(b) * num >= 0;
+}
+
+void fillKnapsackResult(const DataSetView& data, std::vector<int> chosen, SolverResult& result) {
+    std::sort(chosen.begin(), chosen.end());
+    long long weight = 0, value = 0;
+    std::vector<int> subset;
+    subset.reserve(chosen.size());
+    for (int index : chosen) {
+        subset.push_back(data.numbers[index]);
+        weight += data.numbers[index];
+        value += data.values[index];
+    }
+    result.solution_exists = true;
+    result.subsets.push_back(std::move(subset));
+    result.achieved_sum = weight;
+    result.achieved_value = value;
+}
@@ -0,0 +1,29 @@
+// src/CoreSolver/KnapsackCommon.h
+#pragma once
+#include "DataModel/DataSetView.h"
+#include "DataModel/SolverResult.h"
+#include <vector>
+
+// Shared plumbing for the 0/1 knapsack engines: the budget is the capacity,
+// each number is a weight and DataSet::values holds the matching profit.
+struct KnapsackItem {
+    long long weight;
+    long long value;
+    int index;  // position in DataSet::numbers
+};
+
+// Validates a knapsack instance and returns the items worth considering:
+// those with a positive value that fit the budget on their own. Throws
+// std::logic_error for unsupported modes (find all, cardinality rules) and
+// std::invalid_argument for malformed input.
+std::vector<KnapsackItem> loadKnapsackItems(const DataSetView& data, bool find_all, const char* solver_name);
+
+// Orders items by value/weight ratio, best first (exact integer comparison).
+void sortByEfficiency(std::vector<KnapsackItem>& items);
+
+// True when a + b * num / den >= bound, computed without overflow. Used for
+// the Dantzig (LP relaxation) bounds of the branch-and-bound engines.
+bool reachesBound(long long a, long long b, long long num, long long den, long long bound);
+
+// Fills the result with the chosen item positions, listed in input order.
+void fillKnapsackResult(const DataSetView& data, std::vector<int> chosen, SolverResult& result);
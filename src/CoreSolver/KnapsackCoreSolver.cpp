@@ -0,0 +1,95 @@
+// src/CoreSolver/KnapsackCoreSolver.cpp
+#include "KnapsackCoreSolver.h"
+#include "KnapsackCommon.h"
+#include <chrono>
+#include <vector>
+
+namespace {
+
+struct ExpandingCore {
+    const std::vector<KnapsackItem>& items;
+    long long capacity;
+    long long best_value;
+    StopCondition& stop;
+    std::vector<int> flips;       // items toggled relative to the break solution
+    std::vector<int> best_flips;
+
+    // `s` is the next included item that may be removed (moving left from the
+    // break item), `t` the next excluded item that may be added (moving right).
+    void expand(long s, size_t t, long long value, long long weight) {
+        ++stop.progress().nodes;
+        if (weight <= capacity) {
+            if (value > best_value) {
+                best_value = value;
+                best_flips = flips;
+            }
+            // Items after the break item are tried in decreasing efficiency,
+            // so the first one whose bound fails ends the expansion.
+            for (; t < items.size(); ++t) {
+                if (stop.shouldStop()) return;
+                if (!reachesBound(value, capacity - weight, items[t].value, items[t].weight, best_value + 1)) {
+                    ++stop.progress().pruned;
+                    return;
+                }
+                flips.push_back(static_cast<int>(t));
+                expand(s, t + 1, value + items[t].value, weight + items[t].weight);
+                flips.pop_back();
+            }
+        } else {
+            // Over budget: some included item has to go.
+            for (; s >= 0; --s) {
+                if (stop.shouldStop()) return;
+                const KnapsackItem& item = items[static_cast<size_t>(s)];
+                if (item.weight == 0) return;  // zero-weight items are never worth removing
+                if (!reachesBound(value, capacity - weight, item.value, item.weight, best_value + 1)) {
+                    ++stop.progress().pruned;
+                    return;
+                }
+                flips.push_back(static_cast<int>(s));
+                expand(s - 1, t, value - item.value, weight - item.weight);
+                flips.pop_back();
+            }
+        }
+    }
+};
+
+} // namespace
+
+SolverResult KnapsackCoreSolver::solve(const DataSetView& data, bool find_all) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+
+    std::vector<KnapsackItem> items = loadKnapsackItems(data, find_all, "Knapsack core solver");
+
+    SolverResult result;
+    if (data.target_sum >= 0) {
+        sortByEfficiency(items);
+
+        // Break solution: the longest efficiency-ordered prefix that fits.
+        size_t break_item = 0;
+        long long weight = 0, value = 0;
+        while (break_item < items.size() && weight + items[break_item].weight <= data.target_sum) {
+            weight += items[break_item].weight;
+            value += items[break_item].value;
+            ++break_item;
+        }
+
+        ExpandingCore core{items, data.target_sum, value, stop, {}, {}};
+        core.expand(static_cast<long>(break_item) - 1, break_item, value, weight);
+
+        std::vector<char> taken(items.size(), 0);
+        for (size_t i = 0; i < break_item; ++i) taken[i] = 1;
+        for (int position : core.best_flips) taken[position] ^= 1;
+        std::vector<int> chosen;
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (taken[i]) chosen.push_back(items[i].index);
+        }
+        fillKnapsackResult(data, chosen, result);
+    }
+
+    result.status = stop.status();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
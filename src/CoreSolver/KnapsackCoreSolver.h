@@ -0,0 +1,13 @@
+// src/CoreSolver/KnapsackCoreSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+
+// 0/1 knapsack by Pisinger's expanding-core algorithm (expknap). The search
+// starts from the greedy break solution and only flips items around the
+// break item, widening that core while the LP bound says an improvement is
+// still possible. Items far from the break item are never branched on, which
+// makes it the engine of choice for large n.
+class KnapsackCoreSolver : public ISubsetSumSolver {
+public:
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+};
@@ -0,0 +1,76 @@
+// src/CoreSolver/KnapsackDpSolver.cpp
+#include "KnapsackDpSolver.h"
+#include "BitsetOps.h"
+#include "KnapsackCommon.h"
+#include <chrono>
+#include <vector>
+
+SolverResult KnapsackDpSolver::solve(const DataSetView& data, bool find_all) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+
+    PhaseTimer preprocess = stop.time(SolvePhase::Preprocess);
+    const std::vector<KnapsackItem> items = loadKnapsackItems(data, find_all, "Knapsack DP solver");
+    preprocess.stop();
+
+    SolverResult result;
+    if (data.target_sum >= 0) {
+        const std::size_t span = static_cast<std::size_t>(data.target_sum) + 1;
+        const std::size_t words = bitset_ops::wordsFor(span);
+
+        // best[c]: highest value with total weight at most c.
+        // keep row i marks the budgets at which item i improved best[c].
+        PhaseTimer allocate = stop.time(SolvePhase::Allocate);
+        std::vector<long long> best(span, 0);
+        std::vector<bitset_ops::Word> keep(items.size() * words, 0);
+        allocate.stop();
+        // Items processed before a stop request still form a valid instance.
+        size_t processed = 0;
+        stop.progress().steps_total = items.size();
+        PhaseTimer fill = stop.time(SolvePhase::Fill);
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (stop.shouldStop(span)) break;
+            processed = i + 1;
+            stop.progress().steps_done = processed;
+            const std::size_t w = static_cast<std::size_t>(items[i].weight);
+            const long long v = items[i].value;
+            bitset_ops::Word* row = keep.data() + i * words;
+            for (std::size_t c = span - 1; c >= w; --c) {
+                const long long with_item = best[c - w] + v;
+                if (with_item > best[c]) {
+                    best[c] = with_item;
+                    bitset_ops::set(row, c);
+                }
+                if (c == 0) break;
+            }
+        }
+
+        fill.stop();
+
+        PhaseTimer walk = stop.time(SolvePhase::Reconstruct);
+        std::vector<int> chosen;
+        std::size_t c = span - 1;
+        for (size_t i = processed; i-- > 0;) {
+            if (bitset_ops::test(keep.data() + i * words, c)) {
+                chosen.push_back(items[i].index);
+                c -= static_cast<std::size_t>(items[i].weight);
+            }
+        }
+        walk.stop();
+        PhaseTimer output = stop.time(SolvePhase::Output);
+        fillKnapsackResult(data, chosen, result);
+    }
+
+    result.status = stop.status();
+    result.phases = stop.phaseTimes();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
+
+std::uint64_t KnapsackDpSolver::tableBytes(std::size_t items, std::size_t budget) {
+    const std::uint64_t span = static_cast<std::uint64_t>(budget) + 1;
+    const std::uint64_t words = bitset_ops::wordsFor(static_cast<std::size_t>(span));
+    return span * sizeof(long long) + static_cast<std::uint64_t>(items) * words * sizeof(bitset_ops::Word);
+}
@@ -0,0 +1,17 @@
+// src/CoreSolver/KnapsackDpSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include <cstddef>
+#include <cstdint>
+
+// 0/1 knapsack by dense 1D DP over the budget: O(n * budget) time, one
+// machine word per budget unit plus one bit per (item, budget) cell to
+// reconstruct the allocation. Best for moderate budgets.
+class KnapsackDpSolver : public ISubsetSumSolver {
+public:
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+    // Heap bytes solve() allocates for its table with `items` items and this
+    // budget: the best row plus one choice bit per (item, budget) cell.
+    static std::uint64_t tableBytes(std::size_t items, std::size_t budget);
+};
@@ -0,0 +1,12 @@
+// src/CoreSolver/KnapsackSolver.cpp
+#include "KnapsackSolver.h"
+
+SolverResult KnapsackSolver::solve(const DataSetView& data, bool find_all) {
+    const std::size_t n = data.numbers.size();
+    const std::size_t budget = data.target_sum > 0 ? static_cast<std::size_t>(data.target_sum) : 0;
+    ISubsetSumSolver* engine = &m_branchBound;
+    if (KnapsackDpSolver::tableBytes(n, budget) <= kMaxDpBytes) engine = &m_dp;
+    else if (n >= kCoreMinItems) engine = &m_core;
+    shareStopConditions(*engine);
+    return engine->solve(data, find_all);
+}
@@ -0,0 +1,36 @@
+// src/CoreSolver/KnapsackSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include "KnapsackBranchBoundSolver.h"
+#include "KnapsackCoreSolver.h"
+#include "KnapsackDpSolver.h"
+#include <cstddef>
+#include <cstdint>
+
+// Value-weighted budget allocation: maximizes the total of DataSet::values
+// over subsets whose numbers stay within the budget (target_sum). Picks an
+// engine per instance: the dense DP while its table stays small, the
+// expanding-core search for large n, and plain branch and bound otherwise.
+// The engines are kept between solves.
+class KnapsackSolver : public ISubsetSumSolver {
+public:
+    // Largest table (KnapsackDpSolver::tableBytes) the dense DP may allocate.
+    static constexpr std::uint64_t kMaxDpBytes = 64u * 1024u * 1024u;
+    // From this many items on, the core-based engine is preferred.
+    static constexpr std::size_t kCoreMinItems = 1000;
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+    std::size_t workspaceBytes() const override {
+        return m_dp.workspaceBytes() + m_core.workspaceBytes() + m_branchBound.workspaceBytes();
+    }
+    void releaseWorkspace() override {
+        m_dp.releaseWorkspace();
+        m_core.releaseWorkspace();
+        m_branchBound.releaseWorkspace();
+    }
+
+private:
+    KnapsackDpSolver m_dp;
+    KnapsackCoreSolver m_core;
+    KnapsackBranchBoundSolver m_branchBound;
+};
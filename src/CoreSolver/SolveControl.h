@@ -0,0 +1,159 @@
+// src/CoreSolver/SolveControl.h
+#pragma once
+
+#include "DataModel/SolverResult.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+// Cooperative cancellation flag shared between a running solver and whoever
+// may want to stop it (another thread, a UI button).
+class CancellationToken {
+public:
+    void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+    void reset() { m_cancelled.store(false, std::memory_order_relaxed); }
+    bool isCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+};
+
+// Snapshot of a running solve. Solvers fill in the fields that make sense
+// for them and leave the rest at their defaults.
+struct SolveProgress {
+    std::uint64_t steps_done = 0;   // DP rows / items processed
+    std::uint64_t steps_total = 0;  // 0 when the amount of work is not known up front
+    std::uint64_t nodes = 0;        // search nodes explored
+    std::uint64_t pruned = 0;       // search nodes cut off by a bound or constraint
+    std::optional<long long> best_gap;  // target minus the best feasible sum so far
+    double elapsed_ms = 0.0;
+
+    void offerGap(long long gap) {
+        if (!best_gap || gap < *best_gap) best_gap = gap;
+    }
+};
+
+// Receives progress snapshots on the solving thread; it must be quick.
+using ProgressCallback = std::function<void(const SolveProgress&)>;
+
+// Receives each solution subset on the solving thread as soon as an
+// enumerating engine finds it, before solve() returns.
+using SolutionCallback = std::function<void(const std::vector<int>&)>;
+
+// Adds the wall time of its scope (or until stop()) to one phase of a
+// PhaseTimes. Built with a null target when phase timing is off, in which
+// case it never reads the clock.
+class PhaseTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    PhaseTimer(PhaseTimes* times, SolvePhase phase) : m_times(times), m_phase(phase) {
+        if (m_times) m_start = Clock::now();
+    }
+    ~PhaseTimer() { stop(); }
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+    void stop() {
+        if (!m_times) return;
+        (*m_times)[m_phase] += std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+        m_times = nullptr;
+    }
+
+private:
+    PhaseTimes* m_times;
+    SolvePhase m_phase;
+    Clock::time_point m_start{};
+};
+
+// Per-solve view of the stop conditions (cancellation token and deadline).
+// Solvers call shouldStop() at their checkpoints (DP rows, search nodes,
+// ...) passing the amount of work done since the previous call. The token is
+// a relaxed atomic load; the clock is only read once kClockInterval work
+// units have accumulated, so checkpoints stay cheap in hot loops. The same
+// clock reads drive the optional progress callback: solvers update
+// progress() with plain stores and the snapshot is published at most once
+// per reporting interval. It also owns the solve's phase times when phase
+// timing is on.
+class StopCondition {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::uint64_t kClockInterval = 1u << 14;
+
+    StopCondition() = default;
+    StopCondition(const CancellationToken* token, bool has_deadline, Clock::time_point deadline,
+                  const ProgressCallback* progress_callback = nullptr,
+                  Clock::duration progress_interval = Clock::duration::zero(),
+                  const SolutionCallback* solution_callback = nullptr, bool retain_solutions = true,
+                  bool time_phases = false)
+        : m_token(token), m_hasDeadline(has_deadline), m_deadline(deadline),
+          m_callback(progress_callback && *progress_callback ? progress_callback : nullptr),
+          m_onSolution(solution_callback && *solution_callback ? solution_callback : nullptr),
+          m_retainSolutions(retain_solutions || !m_onSolution),
+          m_interval(progress_interval), m_start(Clock::now()), m_nextReport(m_start + progress_interval) {
+        if (time_phases) m_phases.emplace();
+    }
+
+    bool shouldStop(std::uint64_t work = 1) {
+        if (m_status != SolveStatus::Completed) return true;
+        if (m_token && m_token->isCancelled()) {
+            m_status = SolveStatus::Cancelled;
+            return true;
+        }
+        if (m_hasDeadline || m_callback) {
+            m_pendingWork += work;
+            if (m_pendingWork >= kClockInterval) {
+                m_pendingWork = 0;
+                const Clock::time_point now = Clock::now();
+                if (m_callback && now >= m_nextReport) publish(now);
+                if (m_hasDeadline && now >= m_deadline) {
+                    m_status = SolveStatus::TimedOut;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool stopped() const { return m_status != SolveStatus::Completed; }
+    SolveStatus status() const { return m_status; }
+
+    SolveProgress& progress() { return m_progress; }
+
+    // Streams a solution the solver has just recorded in its result.
+    void foundSolution(const std::vector<int>& subset) const {
+        if (m_onSolution) (*m_onSolution)(subset);
+    }
+    // False when the caller consumes solutions from the stream only, so the
+    // solver should not also keep them in SolverResult::subsets.
+    bool retainSolutions() const { return m_retainSolutions; }
+
+    // Scoped timer for one phase; a no-op unless phase timing is on.
+    PhaseTimer time(SolvePhase phase) { return PhaseTimer(m_phases ? &*m_phases : nullptr, phase); }
+    // For SolverResult::phases; empty unless phase timing is on.
+    const std::optional<PhaseTimes>& phaseTimes() const { return m_phases; }
+
+private:
+    const CancellationToken* m_token = nullptr;
+    bool m_hasDeadline = false;
+    Clock::time_point m_deadline{};
+    const ProgressCallback* m_callback = nullptr;
+    const SolutionCallback* m_onSolution = nullptr;
+    bool m_retainSolutions = true;
+    Clock::duration m_interval{};
+    Clock::time_point m_start{};
+    Clock::time_point m_nextReport{};
+    std::uint64_t m_pendingWork = 0;
+    SolveStatus m_status = SolveStatus::Completed;
+    SolveProgress m_progress;
+    std::optional<PhaseTimes> m_phases;
+
+    void publish(Clock::time_point now) {
+        m_progress.elapsed_ms = std::chrono::duration<double, std::milli>(now - m_start).count();
+        m_nextReport = now + m_interval;
+        (*m_callback)(m_progress);
+    }
+};
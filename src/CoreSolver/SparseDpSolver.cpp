@@ -0,0 +1,201 @@
+// src/CoreSolver/SparseDpSolver.cpp
+#include "SparseDpSolver.h"
+#include "BitsetOps.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// A reachable sum together with the index of the first item that reached it.
+// The predecessor sum - nums[item] was necessarily reachable using only items
+// before `item`, which is all the reconstruction needs.
+struct ReachedSum {
+    int sum;
+    int item;
+};
+
+bool bySum(const ReachedSum& a, const ReachedSum& b) { return a.sum < b.sum; }
+
+} // namespace
+
+// Capacities only grow, so repeated solves of similar instances allocate
+// nothing here once the buffers have reached their size.
+struct SparseDpSolver::Workspace {
+    std::vector<ReachedSum> reached;
+    std::vector<ReachedSum> shifted;
+    std::vector<ReachedSum> merged;
+    std::vector<bitset_ops::Word> row;
+    std::vector<bitset_ops::Word> fresh;
+    std::vector<int> subset;
+};
+
+SparseDpSolver::SparseDpSolver(double density_threshold, std::size_t max_states)
+    : m_densityThreshold(density_threshold), m_maxStates(max_states), m_workspace(std::make_unique<Workspace>()) {}
+
+SparseDpSolver::~SparseDpSolver() = default;
+
+std::size_t SparseDpSolver::workspaceBytes() const {
+    const Workspace& ws = *m_workspace;
+    return (ws.reached.capacity() + ws.shifted.capacity() + ws.merged.capacity()) * sizeof(ReachedSum) +
+           (ws.row.capacity() + ws.fresh.capacity()) * sizeof(bitset_ops::Word) + ws.subset.capacity() * sizeof(int);
+}
+
+void SparseDpSolver::releaseWorkspace() {
+    m_workspace = std::make_unique<Workspace>();
+}
+
+SolverResult SparseDpSolver::solve(const DataSetView& data, bool find_all) {
+    if (find_all) {
+        throw std::logic_error("Sparse DP solver does not support 'find all' mode. Use the 'dp' or 'backtrack' algorithm instead.");
+    }
+    if (data.cardinality != CardinalityRule::None) {
+        throw std::logic_error("Sparse DP solver does not support cardinality constraints. Use the 'dp' or 'backtrack' algorithm instead.");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    StopCondition stop = makeStopCondition();
+    PhaseTimer preprocess = stop.time(SolvePhase::Preprocess);
+
+    const auto& nums = data.numbers;
+    const int target = data.target_sum;
+    const int n = static_cast<int>(nums.size());
+    for (int w : nums) {
+        if (w < 0) throw std::invalid_argument("Sparse DP solver requires non-negative numbers.");
+    }
+
+    preprocess.stop();
+    SolverResult result;
+    if (target < 0) {
+        result.phases = stop.phaseTimes();
+        auto end_time = std::chrono::high_resolution_clock::now();
+        result.execution_time = end_time - start_time;
+        return result;
+    }
+
+    const std::size_t span = static_cast<std::size_t>(target) + 1;
+    const double dense_at = m_densityThreshold * static_cast<double>(span);
+
+    // Sparse phase: `reached` is sorted by sum and holds every reachable sum.
+    Workspace& ws = *m_workspace;
+    std::vector<ReachedSum>& reached = ws.reached;
+    std::vector<ReachedSum>& shifted = ws.shifted;
+    std::vector<ReachedSum>& merged = ws.merged;
+    reached.assign(1, ReachedSum{0, -1});
+    bool found = (target == 0);
+    SolveProgress& progress = stop.progress();
+    progress.steps_total = static_cast<std::uint64_t>(n);
+    PhaseTimer sparse_fill = stop.time(SolvePhase::Fill);
+    int i = 0;
+    for (; i < n && !found; ++i) {
+        const int w = nums[i];
+        progress.steps_done = static_cast<std::uint64_t>(i) + 1;
+        if (w == 0 || w > target) continue;
+        if (stop.shouldStop(reached.size())) break;
+
+        shifted.clear();
+        for (const auto& r : reached) {
+            if (r.sum > target - w) break;
+            shifted.push_back({r.sum + w, i});
+        }
+        merged.clear();
+        merged.reserve(reached.size() + shifted.size());
+        std::size_t a = 0, b = 0;
+        while (a < reached.size() || b < shifted.size()) {
+            if (b == shifted.size() || (a < reached.size() && reached[a].sum <= shifted[b].sum)) {
+                if (b < shifted.size() && reached[a].sum == shifted[b].sum) ++b;
+                merged.push_back(reached[a++]);
+            } else {
+                merged.push_back(shifted[b++]);
+            }
+        }
+        reached.swap(merged);
+        progress.offerGap(target - reached.back().sum);
+        found = std::binary_search(reached.begin(), reached.end(), ReachedSum{target, 0}, bySum);
+
+        const bool too_dense = static_cast<double>(reached.size()) > dense_at;
+        const bool over_cap = m_maxStates != 0 && reached.size() > m_maxStates;
+        if (too_dense || over_cap) {
+            ++i;
+            break;
+        }
+    }
+    sparse_fill.stop();
+
+    // Dense phase: a packed bitset answers membership, and only sums reached
+    // for the first time are appended to `reached`, so reconstruction data
+    // still grows with the number of reachable sums.
+    if (!found && i < n && !stop.stopped()) {
+        using bitset_ops::Word;
+        const std::size_t words = bitset_ops::wordsFor(span);
+        PhaseTimer allocate = stop.time(SolvePhase::Allocate);
+        std::vector<Word>& row = ws.row;
+        std::vector<Word>& fresh = ws.fresh;
+        row.assign(words, 0);
+        fresh.resize(words);
+        allocate.stop();
+        PhaseTimer dense_fill = stop.time(SolvePhase::Fill);
+        for (const auto& r : reached) bitset_ops::set(row.data(), static_cast<std::size_t>(r.sum));
+
+        for (; i < n && !found; ++i) {
+            const int w = nums[i];
+            progress.steps_done = static_cast<std::uint64_t>(i) + 1;
+            if (w == 0 || w > target) continue;
+            if (stop.shouldStop(words)) break;
+
+            std::fill(fresh.begin(), fresh.end(), 0);
+            bitset_ops::shiftOr(fresh.data(), row.data(), words, static_cast<std::size_t>(w));
+            bitset_ops::maskTail(fresh.data(), span);
+            for (std::size_t k = 0; k < words; ++k) {
+                Word bits = fresh[k] & ~row[k];
+                row[k] |= bits;
+                while (bits != 0) {
+                    const int bit = bitset_ops::lowestBit(bits);
+                    reached.push_back({static_cast<int>(k * bitset_ops::kWordBits) + bit, i});
+                    bits &= bits - 1;
+                }
+            }
+            // Sums are appended in increasing order, so the last one is this item's best.
+            progress.offerGap(target - reached.back().sum);
+            found = bitset_ops::test(row.data(), static_cast<std::size_t>(target));
+        }
+        std::sort(reached.begin(), reached.end(), bySum);
+    }
+    // `reached` and `merged` trade buffers once per item, so the next solve
+    // may start with them the other way round; give both the larger capacity.
+    const std::size_t capacity = std::max(reached.capacity(), merged.capacity());
+    reached.reserve(capacity);
+    merged.reserve(capacity);
+
+    // Stopped early: settle for the largest sum reached so far.
+    int goal = target;
+    if (!found && stop.stopped()) {
+        goal = reached.back().sum;
+        result.achieved_sum = goal;
+    }
+
+    if (found || stop.stopped()) {
+        result.solution_exists = found;
+        PhaseTimer walk = stop.time(SolvePhase::Reconstruct);
+        std::vector<int>& subset = ws.subset;
+        subset.clear();
+        int curr_sum = goal;
+        while (curr_sum > 0) {
+            auto it = std::lower_bound(reached.begin(), reached.end(), ReachedSum{curr_sum, 0}, bySum);
+            subset.push_back(nums[it->item]);
+            curr_sum -= nums[it->item];
+        }
+        walk.stop();
+        PhaseTimer output = stop.time(SolvePhase::Output);
+        result.subsets.push_back(subset);
+    }
+
+    result.status = stop.status();
+    result.phases = stop.phaseTimes();
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.execution_time = end_time - start_time;
+    return result;
+}
@@ -0,0 +1,29 @@
+// src/CoreSolver/SparseDpSolver.h
+#pragma once
+#include "SubsetSumSolver.h"
+#include <cstddef>
+#include <memory>
+
+// Reachable-sum DP for instances whose target is huge but whose set of
+// reachable sums is small (few, large items). The reachable set is kept as a
+// sorted vector and merged with its shift S + w per item, so memory follows
+// the number of reachable sums rather than target + 1. Once the set covers
+// more than `density_threshold` of [0, target] (or exceeds `max_states`, when
+// non-zero) the solver switches to a packed bitset for the remaining items.
+class SparseDpSolver : public ISubsetSumSolver {
+public:
+    explicit SparseDpSolver(double density_threshold = 0.125, std::size_t max_states = 0);
+    ~SparseDpSolver() override;
+
+    SolverResult solve(const DataSetView& data, bool find_all = false) override;
+
+    std::size_t workspaceBytes() const override;
+    void releaseWorkspace() override;
+
+private:
+    double m_densityThreshold;
+    std::size_t m_maxStates;
+    // Reachable-sum lists and dense rows, reused across solves.
+    struct Workspace;
+    std::unique_ptr<Workspace> m_workspace;
+};
@@ -1,12 +1,74 @@
 // src/CoreSolver/SubsetSumSolver.h
 #pragma once
 
-#include "DataModel/DataSet.h"
+#include "DataModel/DataSetView.h"
 #include "DataModel/SolverResult.h"
+#include "SolveControl.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
 
 class ISubsetSumSolver {
 public:
     virtual ~ISubsetSumSolver() = default;
     // Added find_all parameter to switch between finding one or all solutions
-    virtual SolverResult solve(const DataSet& data, bool find_all = false) = 0;
+    virtual SolverResult solve(const DataSetView& data, bool find_all = false) = 0;
+
+    // Stop conditions for subsequent solves. When either triggers, the solver
+    // returns early with its best-so-far result and SolverResult::status set
+    // to Cancelled or TimedOut. A zero timeout means no deadline.
+    void setCancellationToken(std::shared_ptr<CancellationToken> token) { m_cancelToken = std::move(token); }
+    void setTimeout(std::chrono::milliseconds timeout) { m_timeout = timeout; }
+    // Publishes SolveProgress snapshots at most once per interval while a
+    // solve runs. An empty callback turns reporting off.
+    void setProgressCallback(ProgressCallback callback,
+                             std::chrono::milliseconds interval = std::chrono::milliseconds(100)) {
+        m_progressCallback = std::move(callback);
+        m_progressInterval = interval;
+    }
+    // Streams solutions while an enumerating engine (dp, backtrack) runs;
+    // the other engines only report through the returned SolverResult. With
+    // retain_in_result false, streamed solutions are not also collected in
+    // SolverResult::subsets, which keeps huge enumerations out of memory.
+    void setSolutionCallback(SolutionCallback callback, bool retain_in_result = true) {
+        m_solutionCallback = std::move(callback);
+        m_retainSolutions = retain_in_result;
+    }
+    // Records how long each SolvePhase takes in SolverResult::phases. Off by
+    // default; when off the instrumented engines never read the clock for it.
+    void setPhaseTiming(bool enabled) { m_timePhases = enabled; }
+
+    // Scratch memory (tables, search stacks) that a solver keeps between
+    // solves, so that repeated solves stop allocating once it has grown to
+    // the largest instance seen. It only grows; releaseWorkspace() frees it.
+    // Because of it, one solver instance must not run two solves at once.
+    virtual std::size_t workspaceBytes() const { return 0; }
+    virtual void releaseWorkspace() {}
+
+protected:
+    // Arms the stop conditions for one solve; call at the start of solve().
+    StopCondition makeStopCondition() const {
+        return StopCondition(m_cancelToken.get(), m_timeout.count() > 0,
+                             StopCondition::Clock::now() + m_timeout, &m_progressCallback, m_progressInterval,
+                             &m_solutionCallback, m_retainSolutions, m_timePhases);
+    }
+    // Lets a solver that delegates to another engine pass its conditions on.
+    void shareStopConditions(ISubsetSumSolver& other) const {
+        other.m_cancelToken = m_cancelToken;
+        other.m_timeout = m_timeout;
+        other.m_progressCallback = m_progressCallback;
+        other.m_progressInterval = m_progressInterval;
+        other.m_solutionCallback = m_solutionCallback;
+        other.m_retainSolutions = m_retainSolutions;
+        other.m_timePhases = m_timePhases;
+    }
+
+private:
+    std::shared_ptr<CancellationToken> m_cancelToken;
+    std::chrono::milliseconds m_timeout{0};
+    ProgressCallback m_progressCallback;
+    std::chrono::milliseconds m_progressInterval{100};
+    SolutionCallback m_solutionCallback;
+    bool m_retainSolutions = true;
+    bool m_timePhases = false;
 };
@@ -4,7 +4,19 @@
 #include <vector>
 #include <numeric>
 
+// Optional rule on how many numbers a subset may contain.
+enum class CardinalityRule {
+    None,     // any number of items
+    Exactly,  // exactly cardinality_k items
+    AtMost    // at most cardinality_k items
+};
+
 struct DataSet {
     std::vector<int> numbers;
     int target_sum;
+    CardinalityRule cardinality = CardinalityRule::None;
+    int cardinality_k = 0;
+    // Priority of each number for the knapsack engines (same length as
+    // numbers); empty for plain subset sum.
+    std::vector<int> values;
 };
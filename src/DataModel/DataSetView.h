@@ -0,0 +1,24 @@
+// src/DataModel/DataSetView.h
+#pragma once
+
+#include "DataSet.h"
+#include "Span.h"
+
+// What solvers read: a DataSet whose arrays are borrowed rather than owned,
+// so input that already sits in memory (a parsed buffer, a memory-mapped
+// binary file) is solved without copying it. Converts implicitly from a
+// DataSet, which must outlive the view.
+struct DataSetView {
+    Span<const int> numbers;
+    int target_sum = 0;
+    CardinalityRule cardinality = CardinalityRule::None;
+    int cardinality_k = 0;
+    // Knapsack values, same length as numbers; empty for plain subset sum.
+    Span<const int> values;
+
+    DataSetView() = default;
+    DataSetView(Span<const int> nums, int target) : numbers(nums), target_sum(target) {}
+    DataSetView(const DataSet& data)
+        : numbers(data.numbers), target_sum(data.target_sum), cardinality(data.cardinality),
+          cardinality_k(data.cardinality_k), values(data.values) {}
+};
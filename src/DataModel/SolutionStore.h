@@ -0,0 +1,63 @@
+// src/DataModel/SolutionStore.h
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Compact storage for large numbers of solution subsets: every number lives
+// in one flat array and each subset is an offset range into it, so a
+// find-all run costs one allocation per growth step instead of one per
+// subset.
+class SolutionStore {
+public:
+    // Read-only view of one stored subset.
+    struct Subset {
+        const int* first;
+        std::size_t count;
+
+        const int* begin() const { return first; }
+        const int* end() const { return first + count; }
+        std::size_t size() const { return count; }
+        int operator[](std::size_t i) const { return first[i]; }
+    };
+
+    SolutionStore() : m_offsets{0} {}
+
+    void append(const int* first, std::size_t count) {
+        m_values.insert(m_values.end(), first, first + count);
+        m_offsets.push_back(m_values.size());
+    }
+    void append(const std::vector<int>& subset) { append(subset.data(), subset.size()); }
+    void append(const SolutionStore& other) {
+        for (std::size_t i = 0; i < other.size(); ++i) append(other[i].first, other[i].count);
+    }
+
+    std::size_t size() const { return m_offsets.size() - 1; }
+    bool empty() const { return size() == 0; }
+
+    Subset operator[](std::size_t i) const {
+        return {m_values.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i]};
+    }
+    std::vector<int> toVector(std::size_t i) const {
+        const Subset subset = (*this)[i];
+        return std::vector<int>(subset.begin(), subset.end());
+    }
+
+    void clear() {
+        m_values.clear();
+        m_offsets.assign(1, 0);
+    }
+    void swap(SolutionStore& other) noexcept {
+        m_values.swap(other.m_values);
+        m_offsets.swap(other.m_offsets);
+    }
+
+    // Heap bytes held, for memory reporting.
+    std::size_t memoryBytes() const {
+        return m_values.capacity() * sizeof(int) + m_offsets.capacity() * sizeof(std::size_t);
+    }
+
+private:
+    std::vector<int> m_values;
+    std::vector<std::size_t> m_offsets;  // subset i is m_values[m_offsets[i], m_offsets[i + 1])
+};
@@ -1,12 +1,94 @@
 // src/DataModel/SolverResult.h
 #pragma once
 
+#include <array>
 #include <vector>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+// Why a solve returned.
+enum class SolveStatus {
+    Completed,
+    TimedOut,   // the solver's deadline passed
+    Cancelled   // its cancellation token was triggered
+};
+
+// Heap use of a solve, filled when it ran under an AllocationScope (see
+// Benchmarking/AllocationTracker.h). Sizes are allocator block sizes.
+struct MemoryUsage {
+    std::uint64_t allocations = 0;      // operator new calls
+    std::uint64_t allocated_bytes = 0;  // their total size
+    std::uint64_t peak_heap_bytes = 0;  // highest live heap above the level at the start
+    // Peak resident memory minus the resident memory at the start (Linux).
+    std::optional<std::int64_t> peak_rss_delta_bytes;
+};
+
+// Stages of a solve, for telling allocation-bound from compute-bound runs.
+enum class SolvePhase {
+    Allocate,     // creating and zeroing tables
+    Preprocess,   // validating, sorting or filtering the input
+    Fill,         // the main DP / search loop
+    Reconstruct,  // walking the tables back to a subset
+    Output        // handing solutions to callbacks and the result
+};
+constexpr std::size_t kSolvePhaseCount = 5;
+
+inline const char* phaseName(SolvePhase phase) {
+    switch (phase) {
+        case SolvePhase::Allocate: return "allocate";
+        case SolvePhase::Preprocess: return "preprocess";
+        case SolvePhase::Fill: return "fill";
+        case SolvePhase::Reconstruct: return "reconstruct";
+        default: return "output";
+    }
+}
+
+// Wall time spent in each phase, in ms. Time outside every phase (setup,
+// result bookkeeping) is not counted, so the total is a little below
+// execution_time. Enumeration interleaves walking the table with output, so
+// "find all" solves book both under Reconstruct.
+struct PhaseTimes {
+    std::array<double, kSolvePhaseCount> ms{};
+
+    double& operator[](SolvePhase phase) { return ms[static_cast<std::size_t>(phase)]; }
+    double operator[](SolvePhase phase) const { return ms[static_cast<std::size_t>(phase)]; }
+    double total() const {
+        double sum = 0.0;
+        for (const double x : ms) sum += x;
+        return sum;
+    }
+};
 
 struct SolverResult {
+    // For exact modes this means a subset hits the target. Optimizing and
+    // approximate engines (knapsack, approx) set it whenever they return a
+    // feasible allocation, and report how good it is through the achieved_*
+    // fields below.
     bool solution_exists = false;
     // Now stores all found subsets
     std::vector<std::vector<int>> subsets; 
     std::chrono::duration<double, std::milli> execution_time;
+    // Anything but Completed means the solver stopped early and the other
+    // fields hold its best-so-far (partial) result.
+    SolveStatus status = SolveStatus::Completed;
+    // Filled by the counting engine: number of subsets reaching the target, in
+    // decimal (it may exceed 64 bits). Empty when the solver did not count.
+    std::string solution_count;
+    // Non-zero when solution_count was reduced modulo this value.
+    std::uint64_t count_modulus = 0;
+    // Total of the returned subset's numbers and (knapsack) values, for
+    // engines that optimize rather than hit the target exactly.
+    std::optional<long long> achieved_sum;
+    std::optional<long long> achieved_value;
+    // Proven upper bound on the best achievable sum, reported by approximate
+    // engines alongside achieved_sum to quantify the remaining gap.
+    std::optional<long long> optimum_upper_bound;
+    // Set by trackedSolve(); solvers themselves do not fill it.
+    std::optional<MemoryUsage> memory;
+    // Filled when phase timing is on (ISubsetSumSolver::setPhaseTiming) by
+    // the engines that record phases: dp, sparse and knapsack-dp.
+    std::optional<PhaseTimes> phases;
 };
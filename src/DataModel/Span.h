@@ -0,0 +1,35 @@
+// src/DataModel/Span.h
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Minimal non-owning view of a contiguous array (std::span is C++20). A
+// Span<const int> binds implicitly to a std::vector<int>, so code that takes
+// spans accepts vectors unchanged.
+template <typename T>
+class Span {
+public:
+    using value_type = std::remove_cv_t<T>;
+
+    constexpr Span() = default;
+    constexpr Span(T* data, std::size_t size) : m_data(data), m_size(size) {}
+    template <typename U, typename = std::enable_if_t<std::is_const<T>::value && std::is_same<U, value_type>::value>>
+    Span(const std::vector<U>& values) : m_data(values.data()), m_size(values.size()) {}
+    Span(std::vector<value_type>& values) : m_data(values.data()), m_size(values.size()) {}
+
+    constexpr T* data() const { return m_data; }
+    constexpr std::size_t size() const { return m_size; }
+    constexpr bool empty() const { return m_size == 0; }
+    constexpr T* begin() const { return m_data; }
+    constexpr T* end() const { return m_data + m_size; }
+    constexpr T& operator[](std::size_t i) const { return m_data[i]; }
+    constexpr T& front() const { return m_data[0]; }
+    constexpr T& back() const { return m_data[m_size - 1]; }
+    constexpr Span subspan(std::size_t offset, std::size_t count) const { return Span(m_data + offset, count); }
+
+private:
+    T* m_data = nullptr;
+    std::size_t m_size = 0;
+};
@@ -0,0 +1,247 @@
+// src/GUI/BenchmarkPanel.cpp
+#include "BenchmarkPanel.h"
+#include "AlgorithmSelector/SolverFactory.h"
+#include <algorithm>
+#include <chrono>
+
+#include <QListWidget>
+#include <QSpinBox>
+#include <QPushButton>
+#include <QLabel>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFormLayout>
+#include <QMetaObject>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCharts/QChart>
+#include <QtCharts/QChartView>
+#include <QtCharts/QBoxPlotSeries>
+#include <QtCharts/QBoxSet>
+#include <QtCharts/QBarSeries>
+#include <QtCharts/QBarSet>
+#include <QtCharts/QBarCategoryAxis>
+#include <QtCharts/QValueAxis>
+
+namespace {
+
+// Samples are handed to the GUI thread at most this often per engine, so
+// microsecond-fast engines do not flood the event queue.
+constexpr std::chrono::milliseconds kPostInterval(50);
+
+} // namespace
+
+BenchmarkPanel::BenchmarkPanel(InputProvider input, QWidget* parent)
+    : QWidget(parent), m_input(std::move(input))
+{
+    m_engineList = new QListWidget;
+    for (const std::string& type : SolverFactory::registeredTypes()) {
+        QListWidgetItem* item = new QListWidgetItem(QString::fromStdString(type), m_engineList);
+        item->setFlags(item->flags() | Qt::ItemIsUserCheckable);
+        item->setCheckState(Qt::Checked);
+    }
+    m_iterationsInput = new QSpinBox;
+    m_iterationsInput->setRange(1, 10000);
+    m_iterationsInput->setValue(20);
+    m_runButton = new QPushButton("Run Benchmark");
+    m_cancelButton = new QPushButton("Cancel");
+    m_cancelButton->setEnabled(false);
+    m_statusLabel = new QLabel;
+    m_statusLabel->setWordWrap(true);
+
+    m_latencySeries = new QBoxPlotSeries;
+    m_latencyCategories = new QBarCategoryAxis;
+    m_latencyAxis = new QValueAxis;
+    m_latencyAxis->setTitleText("ms per solve");
+    QChart* latencyChart = new QChart;
+    latencyChart->setTitle("Latency distribution");
+    latencyChart->legend()->hide();
+    latencyChart->addSeries(m_latencySeries);
+    latencyChart->addAxis(m_latencyCategories, Qt::AlignBottom);
+    latencyChart->addAxis(m_latencyAxis, Qt::AlignLeft);
+    m_latencySeries->attachAxis(m_latencyCategories);
+    m_latencySeries->attachAxis(m_latencyAxis);
+    m_latencyView = new QChartView(latencyChart);
+
+    m_memorySeries = new QBarSeries;
+    m_memorySet = new QBarSet("Peak RSS");
+    m_memorySeries->append(m_memorySet);
+    m_memoryCategories = new QBarCategoryAxis;
+    m_memoryAxis = new QValueAxis;
+    m_memoryAxis->setTitleText("MiB");
+    QChart* memoryChart = new QChart;
+    memoryChart->setTitle("Peak memory");
+    memoryChart->legend()->hide();
+    memoryChart->addSeries(m_memorySeries);
+    memoryChart->addAxis(m_memoryCategories, Qt::AlignBottom);
+    memoryChart->addAxis(m_memoryAxis, Qt::AlignLeft);
+    m_memorySeries->attachAxis(m_memoryCategories);
+    m_memorySeries->attachAxis(m_memoryAxis);
+    m_memoryView = new QChartView(memoryChart);
+
+    QFormLayout* settingsLayout = new QFormLayout;
+    settingsLayout->addRow(new QLabel("Engines:"), m_engineList);
+    settingsLayout->addRow(new QLabel("Iterations:"), m_iterationsInput);
+    QHBoxLayout* buttonLayout = new QHBoxLayout;
+    buttonLayout->addWidget(m_runButton, 3);
+    buttonLayout->addWidget(m_cancelButton, 1);
+    QHBoxLayout* chartLayout = new QHBoxLayout;
+    chartLayout->addWidget(m_latencyView, 2);
+    chartLayout->addWidget(m_memoryView, 1);
+    QVBoxLayout* mainLayout = new QVBoxLayout;
+    mainLayout->addLayout(settingsLayout);
+    mainLayout->addLayout(buttonLayout);
+    mainLayout->addWidget(m_statusLabel);
+    mainLayout->addLayout(chartLayout, 1);
+    setLayout(mainLayout);
+
+    connect(m_runButton, &QPushButton::clicked, this, &BenchmarkPanel::onRunClicked);
+    connect(m_cancelButton, &QPushButton::clicked, this, &BenchmarkPanel::onCancelClicked);
+    connect(&m_runWatcher, &QFutureWatcher<void>::finished, this, &BenchmarkPanel::onRunFinished);
+}
+
+BenchmarkPanel::~BenchmarkPanel()
+{
+    // Queued updates target this widget: let the worker finish first.
+    if (m_runWatcher.isRunning()) {
+        m_cancelToken->cancel();
+        m_runWatcher.waitForFinished();
+    }
+}
+
+void BenchmarkPanel::onRunClicked()
+{
+    if (m_runWatcher.isRunning()) return;
+
+    DataSet data;
+    bool find_all = false;
+    if (!m_input(data, find_all)) return;
+
+    std::vector<std::string> engines;
+    for (int row = 0; row < m_engineList->count(); ++row) {
+        const QListWidgetItem* item = m_engineList->item(row);
+        if (item->checkState() == Qt::Checked) engines.push_back(item->text().toStdString());
+    }
+    if (engines.empty()) {
+        m_statusLabel->setText("Select at least one engine.");
+        return;
+    }
+
+    resetCharts();
+    m_cancelToken = std::make_shared<CancellationToken>();
+    m_runButton->setEnabled(false);
+    m_cancelButton->setEnabled(true);
+    m_statusLabel->setText("Running...");
+
+    const int iterations = m_iterationsInput->value();
+    std::shared_ptr<CancellationToken> token = m_cancelToken;
+    m_runWatcher.setFuture(QtConcurrent::run([this, engines, data, find_all, iterations, token]() {
+        for (const std::string& type : engines) {
+            if (token->isCancelled()) break;
+            const QString engine = QString::fromStdString(type);
+            BenchmarkResult result{};
+            QString error;
+            std::vector<double> pending;
+            auto last_post = std::chrono::steady_clock::now();
+            auto post = [this, engine, &pending, &last_post]() {
+                QMetaObject::invokeMethod(this, [this, engine, samples = pending]() { addSamples(engine, samples); },
+                                          Qt::QueuedConnection);
+                pending.clear();
+                last_post = std::chrono::steady_clock::now();
+            };
+            try {
+                auto solver = SolverFactory::createSolver(type);
+                solver->setCancellationToken(token);
+                BenchmarkOptions options;
+                options.iterations = iterations;
+                options.max_iterations = iterations;
+                options.warmup_iterations = 1;
+                options.find_all = find_all;
+                result = BenchmarkRunner::run(*solver, data, options, [&](int, const SolverResult& solve) {
+                    pending.push_back(solve.execution_time.count());
+                    if (std::chrono::steady_clock::now() - last_post >= kPostInterval) post();
+                });
+            } catch (const std::exception& e) {
+                error = QString::fromStdString(e.what());
+            }
+            if (!pending.empty()) post();
+            QMetaObject::invokeMethod(this, [this, engine, result, error]() { finishEngine(engine, result, error); },
+                                      Qt::QueuedConnection);
+        }
+    }));
+}
+
+void BenchmarkPanel::onCancelClicked()
+{
+    if (m_cancelToken) m_cancelToken->cancel();
+    m_cancelButton->setEnabled(false);
+}
+
+void BenchmarkPanel::onRunFinished()
+{
+    m_runButton->setEnabled(true);
+    m_cancelButton->setEnabled(false);
+    const QString done = m_cancelToken && m_cancelToken->isCancelled() ? "Cancelled." : "Done.";
+    m_statusLabel->setText(m_statusLabel->text() + " " + done);
+}
+
+// New samples for one engine: grow its box (created on first use) and rescale.
+void BenchmarkPanel::addSamples(const QString& engine, const std::vector<double>& samples_ms)
+{
+    std::vector<double>& sorted = m_samples[engine];
+    const size_t old_size = sorted.size();
+    sorted.insert(sorted.end(), samples_ms.begin(), samples_ms.end());
+    std::sort(sorted.begin() + static_cast<std::ptrdiff_t>(old_size), sorted.end());
+    std::inplace_merge(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(old_size), sorted.end());
+    if (sorted.empty()) return;
+
+    QBoxSet*& box = m_boxes[engine];
+    if (!box) {
+        box = new QBoxSet(engine);
+        m_latencySeries->append(box);
+        m_latencyCategories->append(engine);
+    }
+    box->setValue(QBoxSet::LowerExtreme, sorted.front());
+    box->setValue(QBoxSet::LowerQuartile, benchmark_stats::quantile(sorted, 0.25));
+    box->setValue(QBoxSet::Median, benchmark_stats::quantile(sorted, 0.5));
+    box->setValue(QBoxSet::UpperQuartile, benchmark_stats::quantile(sorted, 0.75));
+    box->setValue(QBoxSet::UpperExtreme, sorted.back());
+    m_maxLatency = std::max(m_maxLatency, sorted.back());
+    m_latencyAxis->setRange(0.0, m_maxLatency * 1.1);
+}
+
+void BenchmarkPanel::finishEngine(const QString& engine, const BenchmarkResult& result, const QString& error)
+{
+    QString line;
+    if (!error.isEmpty()) {
+        line = QString("%1: skipped (%2)").arg(engine, error);
+    } else {
+        line = QString("%1: %2 runs, mean %3 ms, p99 %4 ms, %5 outliers")
+                   .arg(engine)
+                   .arg(result.iterations)
+                   .arg(result.average_time.count())
+                   .arg(result.stats.p99)
+                   .arg(static_cast<qulonglong>(result.stats.outliers.total()));
+        if (result.peak_rss_bytes) {
+            const double mib = static_cast<double>(*result.peak_rss_bytes) / (1024.0 * 1024.0);
+            m_memorySet->append(mib);
+            m_memoryCategories->append(engine);
+            m_maxMemory = std::max(m_maxMemory, mib);
+            m_memoryAxis->setRange(0.0, m_maxMemory * 1.1);
+        }
+    }
+    const QString previous = m_statusLabel->text() == "Running..." ? QString() : m_statusLabel->text() + "\n";
+    m_statusLabel->setText(previous + line);
+}
+
+void BenchmarkPanel::resetCharts()
+{
+    m_latencySeries->clear();
+    m_latencyCategories->clear();
+    m_memorySet->remove(0, m_memorySet->count());
+    m_memoryCategories->clear();
+    m_samples.clear();
+    m_boxes.clear();
+    m_maxLatency = 0.0;
+    m_maxMemory = 0.0;
+    m_statusLabel->clear();
+}
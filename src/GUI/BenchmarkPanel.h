@@ -0,0 +1,74 @@
+// src/GUI/BenchmarkPanel.h
+#pragma once
+
+#include <QWidget>
+#include <QFutureWatcher>
+#include <QString>
+#include "Benchmarking/Benchmark.h"
+#include "CoreSolver/SolveControl.h"
+#include "DataModel/DataSet.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+class QListWidget;
+class QSpinBox;
+class QPushButton;
+class QLabel;
+class QChartView;
+class QBoxPlotSeries;
+class QBoxSet;
+class QBarSeries;
+class QBarSet;
+class QBarCategoryAxis;
+class QValueAxis;
+
+// Runs BenchmarkRunner for every selected engine on the current input in a
+// background thread and charts the latency distribution (box plot) and peak
+// memory of each engine, updating as iterations complete.
+class BenchmarkPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    // Reads the main window's input; returns false (after telling the user)
+    // when it is not valid.
+    using InputProvider = std::function<bool(DataSet& data, bool& find_all)>;
+
+    explicit BenchmarkPanel(InputProvider input, QWidget* parent = nullptr);
+    ~BenchmarkPanel();
+
+private slots:
+    void onRunClicked();
+    void onCancelClicked();
+    void onRunFinished();
+
+private:
+    void addSamples(const QString& engine, const std::vector<double>& samples_ms);
+    void finishEngine(const QString& engine, const BenchmarkResult& result, const QString& error);
+    void resetCharts();
+
+    InputProvider m_input;
+    QFutureWatcher<void> m_runWatcher;
+    std::shared_ptr<CancellationToken> m_cancelToken;
+    std::map<QString, std::vector<double>> m_samples;  // sorted, per engine
+    std::map<QString, QBoxSet*> m_boxes;
+    double m_maxLatency = 0.0;
+    double m_maxMemory = 0.0;
+
+    QListWidget* m_engineList;
+    QSpinBox* m_iterationsInput;
+    QPushButton* m_runButton;
+    QPushButton* m_cancelButton;
+    QLabel* m_statusLabel;
+    QChartView* m_latencyView;
+    QBoxPlotSeries* m_latencySeries;
+    QBarCategoryAxis* m_latencyCategories;
+    QValueAxis* m_latencyAxis;
+    QChartView* m_memoryView;
+    QBarSeries* m_memorySeries;
+    QBarSet* m_memorySet;
+    QBarCategoryAxis* m_memoryCategories;
+    QValueAxis* m_memoryAxis;
+};
@@ -1,9 +1,11 @@
 // src/GUI/MainWindow.cpp
 #include "MainWindow.h"
 #include "AlgorithmSelector/SolverFactory.h"
+#include "SolutionListModel.h"
+#include "BenchmarkPanel.h"
+#include "Parsing/NumberParser.h"
 #include <vector>
 #include <string>
-#include <sstream>
 #include <cstdio> // For popen
 
 // --- Make sure to include the JSON header ---
@@ -22,25 +24,12 @@
 #include <QLabel>
 #include <QGroupBox>
 #include <QMessageBox>
-
-// (parseGuiNumbers helper function is unchanged)
-std::vector<int> parseGuiNumbers(const QString& text) {
-    std::vector<int> numbers;
-    std::string stdStr = text.toStdString();
-    std::stringstream ss(stdStr);
-    std::string item;
-    while (std::getline(ss, item, ',')) {
-        try {
-            item.erase(0, item.find_first_not_of(" \t\n\r"));
-            item.erase(item.find_last_not_of(" \t\n\r") + 1);
-            if (!item.empty()) {
-                numbers.push_back(std::stoi(item));
-            }
-        } catch (...) { /* Ignore invalid numbers */ }
-    }
-    return numbers;
-}
-
+#include <QProgressBar>
+#include <QCheckBox>
+#include <QTimer>
+#include <QListView>
+#include <QTabWidget>
+#include <QtConcurrent/QtConcurrentRun>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -51,9 +40,28 @@ MainWindow::MainWindow(QWidget *parent)
     m_targetInput = new QLineEdit;
     m_targetInput->setPlaceholderText("Enter target sum");
     m_algorithmSelector = new QComboBox;
-    m_algorithmSelector->addItems({"backtrack", "dp"});
+    m_algorithmSelector->addItems({"backtrack", "dp", "sparse"});
+    m_findAllCheck = new QCheckBox("Find all solutions");
     m_solveButton = new QPushButton("SOLVE");
+    m_cancelButton = new QPushButton("Cancel");
+    m_cancelButton->setEnabled(false);
+    m_flushTimer = new QTimer(this);
+    m_flushTimer->setInterval(50);
+    m_progressBar = new QProgressBar;
+    m_progressBar->setRange(0, 1000);
+    m_progressBar->setValue(0);
+    m_progressBar->setTextVisible(false);
+    m_progressLabel = new QLabel;
     m_resultsDisplay = new QTextBrowser;
+    m_resultsDisplay->setMaximumHeight(140);
+    m_solutionsModel = new SolutionListModel(this);
+    m_solutionsView = new QListView;
+    m_solutionsView->setModel(m_solutionsModel);
+    m_solutionsView->setUniformItemSizes(true);  // lets the view skip measuring every row
+    m_filterInput = new QLineEdit;
+    m_filterInput->setPlaceholderText("Only subsets containing this number");
+    m_sortSelector = new QComboBox;
+    m_sortSelector->addItems({"Order found", "Fewest numbers first", "Most numbers first", "Lexicographic"});
     m_saveButton = new QPushButton("Save to Database");
     m_saveButton->setEnabled(false);
     QFormLayout* inputLayout = new QFormLayout;
@@ -70,15 +78,37 @@ MainWindow::MainWindow(QWidget *parent)
     leftLayout->addWidget(dbGroup);
     QFormLayout* controlsLayout = new QFormLayout;
     controlsLayout->addRow(new QLabel("Algorithm:"), m_algorithmSelector);
+    controlsLayout->addRow(m_findAllCheck);
     QGroupBox* controlsGroup = new QGroupBox("Controls");
     controlsGroup->setLayout(controlsLayout);
     QVBoxLayout* rightLayout = new QVBoxLayout;
     rightLayout->addWidget(controlsGroup);
-    rightLayout->addWidget(m_solveButton);
+    QHBoxLayout* solveLayout = new QHBoxLayout;
+    solveLayout->addWidget(m_solveButton, 3);
+    solveLayout->addWidget(m_cancelButton, 1);
+    rightLayout->addLayout(solveLayout);
+    rightLayout->addWidget(m_progressBar);
+    rightLayout->addWidget(m_progressLabel);
     rightLayout->addWidget(m_resultsDisplay);
+    QHBoxLayout* viewOptionsLayout = new QHBoxLayout;
+    viewOptionsLayout->addWidget(new QLabel("Filter:"));
+    viewOptionsLayout->addWidget(m_filterInput, 1);
+    viewOptionsLayout->addWidget(new QLabel("Sort:"));
+    viewOptionsLayout->addWidget(m_sortSelector);
+    rightLayout->addLayout(viewOptionsLayout);
+    rightLayout->addWidget(m_solutionsView, 1);
+    QWidget* solveTab = new QWidget;
+    solveTab->setLayout(rightLayout);
+    m_benchmarkPanel = new BenchmarkPanel([this](DataSet& data, bool& find_all) {
+        find_all = m_findAllCheck->isChecked();
+        return readInput(data);
+    });
+    QTabWidget* tabs = new QTabWidget;
+    tabs->addTab(solveTab, "Solve");
+    tabs->addTab(m_benchmarkPanel, "Benchmark");
     QHBoxLayout* mainLayout = new QHBoxLayout;
     mainLayout->addLayout(leftLayout, 1);
-    mainLayout->addLayout(rightLayout, 2);
+    mainLayout->addWidget(tabs, 2);
     QWidget* centralWidget = new QWidget;
     centralWidget->setLayout(mainLayout);
     setCentralWidget(centralWidget);
@@ -88,40 +118,196 @@ MainWindow::MainWindow(QWidget *parent)
     // --- Connect Signals and Slots ---
     connect(m_solveButton, &QPushButton::clicked, this, &MainWindow::onSolveClicked);
     connect(m_saveButton, &QPushButton::clicked, this, &MainWindow::onSaveClicked); // <-- CONNECT THE SAVE BUTTON
+    connect(m_cancelButton, &QPushButton::clicked, this, &MainWindow::onCancelClicked);
+    connect(&m_solveWatcher, &QFutureWatcher<SolveOutcome>::finished, this, &MainWindow::onSolveFinished);
+    connect(m_flushTimer, &QTimer::timeout, this, &MainWindow::flushStreamedResults);
+    connect(m_filterInput, &QLineEdit::editingFinished, this, &MainWindow::onViewOptionsChanged);
+    connect(m_sortSelector, &QComboBox::currentIndexChanged, this, &MainWindow::onViewOptionsChanged);
 }
 
-MainWindow::~MainWindow() {}
+MainWindow::~MainWindow()
+{
+    // The worker reports into this object: stop it before members go away.
+    if (m_solveWatcher.isRunning()) {
+        m_cancelToken->cancel();
+        m_solveWatcher.waitForFinished();
+    }
+}
 
 void MainWindow::onSolveClicked()
 {
+    if (m_solveWatcher.isRunning()) return;
+
     DataSet data;
-    data.numbers = parseGuiNumbers(m_numbersInput->toPlainText());
-    
-    bool ok;
-    data.target_sum = m_targetInput->text().toInt(&ok);
-    if (!ok || m_targetInput->text().isEmpty()) {
-        QMessageBox::warning(this, "Input Error", "Please enter a valid integer for the target sum.");
-        return;
-    }
+    if (!readInput(data)) return;
 
     std::string algo_type = m_algorithmSelector->currentText().toStdString();
-    
-    try {
-        auto solver = SolverFactory::createSolver(algo_type);
-        SolverResult result = solver->solve(data, false); 
-        displayResult(result);
-        
-        // Store the result if a solution exists
-        if (result.solution_exists) {
-            m_lastData = data;
-            m_lastResult = result;
-            m_lastAlgorithm = algo_type;
-        }
-        m_saveButton->setEnabled(result.solution_exists);
+    const bool find_all = m_findAllCheck->isChecked();
 
+    std::shared_ptr<ISubsetSumSolver> solver;
+    try {
+        solver = SolverFactory::createSolver(algo_type);
     } catch (const std::exception& e) {
         QMessageBox::critical(this, "Solver Error", e.what());
+        return;
+    }
+
+    // The callbacks run on the worker thread: they only fill the pending
+    // buffers, which flushStreamedResults() drains on the GUI thread.
+    m_cancelToken = std::make_shared<CancellationToken>();
+    solver->setCancellationToken(m_cancelToken);
+    solver->setProgressCallback([this](const SolveProgress& progress) {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_pendingProgress = progress;
+    });
+    // Streamed solutions go straight to the model's compact store; the
+    // result does not keep a second copy.
+    solver->setSolutionCallback([this](const std::vector<int>& subset) {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_pendingSolutions.append(subset);
+    }, false);
+
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_pendingSolutions.clear();
+        m_pendingProgress.reset();
+    }
+    // Sorted views re-sort on every streamed batch; stream in discovery
+    // order and let the user pick an ordering once the solve has finished.
+    m_sortSelector->setCurrentIndex(0);
+    m_solutionsModel->clear();
+    m_runningData = data;
+    m_runningAlgorithm = algo_type;
+    m_resultsDisplay->setHtml("<h3>Solving...</h3>");
+    m_progressBar->setRange(0, 1000);
+    m_progressBar->setValue(0);
+    m_progressLabel->clear();
+    setSolving(true);
+
+    m_solveWatcher.setFuture(QtConcurrent::run([solver, data, find_all]() {
+        SolveOutcome outcome;
+        try {
+            outcome.result = solver->solve(data, find_all);
+        } catch (const std::exception& e) {
+            outcome.error = QString::fromStdString(e.what());
+        }
+        return outcome;
+    }));
+}
+
+bool MainWindow::readInput(DataSet& data)
+{
+    try {
+        data.numbers = number_parser::parseList(m_numbersInput->toPlainText().toStdString());
+    } catch (const ParseError& e) {
+        QMessageBox::warning(this, "Input Error", QString("Numbers: %1").arg(e.what()));
+        return false;
+    }
+
+    try {
+        data.target_sum = number_parser::parseInteger(m_targetInput->text().toStdString());
+    } catch (const ParseError&) {
+        QMessageBox::warning(this, "Input Error", "Please enter a valid integer for the target sum.");
+        return false;
     }
+    return true;
+}
+
+void MainWindow::onCancelClicked()
+{
+    if (m_cancelToken) m_cancelToken->cancel();
+    m_cancelButton->setEnabled(false);
+}
+
+void MainWindow::onSolveFinished()
+{
+    flushStreamedResults();
+    setSolving(false);
+    const SolveOutcome outcome = m_solveWatcher.result();
+    if (!outcome.error.isEmpty()) {
+        m_resultsDisplay->clear();
+        QMessageBox::critical(this, "Solver Error", outcome.error);
+        return;
+    }
+
+    const SolverResult& result = outcome.result;
+    // Engines that do not stream hand their subsets back in the result.
+    if (!result.subsets.empty()) {
+        SolutionStore returned;
+        for (const auto& subset : result.subsets) returned.append(subset);
+        m_solutionsModel->appendSolutions(returned);
+    }
+    m_progressBar->setRange(0, 1000);
+    m_progressBar->setValue(1000);
+    displayResult(result);
+
+    // Store the result if a solution exists
+    if (result.solution_exists) {
+        m_lastData = m_runningData;
+        m_lastResult = result;
+        m_lastAlgorithm = m_runningAlgorithm;
+    }
+    m_saveButton->setEnabled(result.solution_exists);
+}
+
+// Drains what the worker produced since the last tick. Appending a batch per
+// tick keeps the event loop free even when solutions arrive by the thousand.
+void MainWindow::flushStreamedResults()
+{
+    SolutionStore batch;
+    std::optional<SolveProgress> progress;
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        batch.swap(m_pendingSolutions);
+        progress.swap(m_pendingProgress);
+    }
+    if (progress) showProgress(*progress);
+    if (batch.empty()) return;
+    m_solutionsModel->appendSolutions(batch);
+    m_resultsDisplay->setHtml(QString("<h3>Solving...</h3><b>Solutions so far:</b> %1")
+                                  .arg(static_cast<qulonglong>(m_solutionsModel->totalSolutions())));
+}
+
+void MainWindow::onViewOptionsChanged()
+{
+    bool ok = false;
+    const int number = m_filterInput->text().trimmed().toInt(&ok);
+    m_solutionsModel->setFilter(ok ? std::optional<int>(number) : std::nullopt);
+
+    switch (m_sortSelector->currentIndex()) {
+    case 1: m_solutionsModel->setOrdering(SolutionListModel::SortKey::Size, Qt::AscendingOrder); break;
+    case 2: m_solutionsModel->setOrdering(SolutionListModel::SortKey::Size, Qt::DescendingOrder); break;
+    case 3: m_solutionsModel->setOrdering(SolutionListModel::SortKey::Lexicographic, Qt::AscendingOrder); break;
+    default: m_solutionsModel->setOrdering(SolutionListModel::SortKey::None, Qt::AscendingOrder); break;
+    }
+}
+
+// Runs on the GUI thread with the latest snapshot the worker published.
+void MainWindow::showProgress(const SolveProgress& progress)
+{
+    if (progress.steps_total != 0) {
+        m_progressBar->setRange(0, 1000);
+        m_progressBar->setValue(static_cast<int>(1000 * progress.steps_done / progress.steps_total));
+    } else {
+        m_progressBar->setRange(0, 0);  // unknown total: busy indicator
+    }
+    QString text = QString("%1 ms").arg(static_cast<qlonglong>(progress.elapsed_ms));
+    if (progress.nodes != 0) {
+        text += QString(" | %1 nodes, %2% pruned").arg(progress.nodes).arg(100 * progress.pruned / progress.nodes);
+    }
+    if (progress.best_gap) text += QString(" | best gap %1").arg(*progress.best_gap);
+    m_progressLabel->setText(text);
+}
+
+void MainWindow::setSolving(bool solving)
+{
+    m_solveButton->setEnabled(!solving);
+    m_cancelButton->setEnabled(solving);
+    m_saveButton->setEnabled(false);
+    // Sorted views need every row up front, so wait for the final set.
+    m_sortSelector->setEnabled(!solving);
+    if (solving) m_flushTimer->start();
+    else m_flushTimer->stop();
 }
 
 // --- NEW SLOT IMPLEMENTATION ---
@@ -136,7 +322,10 @@ void MainWindow::onSaveClicked()
     j["dataset"]["target_sum"] = m_lastData.target_sum;
     j["result"]["solution_found"] = m_lastResult.solution_exists;
     j["result"]["execution_time_ms"] = m_lastResult.execution_time.count();
-    j["result"]["subsets"] = m_lastResult.subsets;
+    nlohmann::json subsets = nlohmann::json::array();
+    const SolutionStore& store = m_solutionsModel->store();
+    for (size_t i = 0; i < store.size(); ++i) subsets.push_back(store.toVector(i));
+    j["result"]["subsets"] = subsets;
 
     // The Python script is in the root, one level up from the `build` dir
     std::string command = "python3 ../db_handler.py";
@@ -161,20 +350,13 @@ void MainWindow::displayResult(const SolverResult& result)
     QString html;
     html += "<h3>Solver Results</h3>";
     html += QString("<b>Execution Time:</b> %1 ms<br>").arg(result.execution_time.count());
+    if (result.status == SolveStatus::Cancelled) html += "<b>Status:</b> cancelled (partial result)<br>";
+    else if (result.status == SolveStatus::TimedOut) html += "<b>Status:</b> timed out (partial result)<br>";
     
+    // The subsets themselves are listed by m_solutionsView.
     if (result.solution_exists) {
-        html += QString("<b>Solutions Found:</b> %1<br><br>").arg(result.subsets.size());
-        int count = 1;
-        for (const auto& subset : result.subsets) {
-            QString subsetStr;
-            for (size_t i = 0; i < subset.size(); ++i) {
-                subsetStr += QString::number(subset[i]);
-                if (i < subset.size() - 1) {
-                    subsetStr += ", ";
-                }
-            }
-            html += QString("<b>Subset %1:</b> { %2 }<br>").arg(count++).arg(subsetStr);
-        }
+        html += QString("<b>Solutions Found:</b> %1<br>")
+                    .arg(static_cast<qulonglong>(m_solutionsModel->totalSolutions()));
     } else {
         html += "<br><b>Solution Found:</b> No";
     }
@@ -2,8 +2,16 @@
 #pragma once
 
 #include <QMainWindow>
+#include <QFutureWatcher>
+#include <QString>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 #include "DataModel/DataSet.h"     // <-- Make sure this is included
 #include "DataModel/SolverResult.h"  // <-- Make sure this is included
+#include "CoreSolver/SolveControl.h"
+#include "DataModel/SolutionStore.h"
 
 // (Forward declarations are unchanged)
 class QTextEdit;
@@ -11,6 +19,19 @@ class QLineEdit;
 class QComboBox;
 class QPushButton;
 class QTextBrowser;
+class QProgressBar;
+class QLabel;
+class QCheckBox;
+class QTimer;
+class QListView;
+class SolutionListModel;
+class BenchmarkPanel;
+
+// What a background solve hands back to the GUI thread.
+struct SolveOutcome {
+    SolverResult result;
+    QString error;  // non-empty if the solver threw
+};
 
 class MainWindow : public QMainWindow
 {
@@ -23,9 +44,16 @@ public:
 private slots:
     void onSolveClicked();
     void onSaveClicked(); // <-- ADD THIS NEW SLOT
+    void onCancelClicked();
+    void onSolveFinished();
+    void flushStreamedResults();
+    void onViewOptionsChanged();
 
 private:
+    bool readInput(DataSet& data);
     void displayResult(const SolverResult& result);
+    void showProgress(const SolveProgress& progress);
+    void setSolving(bool solving);
 
     // --- Add Member variables to store the last run ---
     DataSet m_lastData;
@@ -33,11 +61,32 @@ private:
     std::string m_lastAlgorithm;
     // --------------------------------------------------
 
+    // --- Background solve state ---
+    // The worker thread only touches the pending buffers (under the mutex);
+    // a GUI-thread timer drains them into the widgets in batches.
+    QFutureWatcher<SolveOutcome> m_solveWatcher;
+    std::shared_ptr<CancellationToken> m_cancelToken;
+    DataSet m_runningData;
+    std::string m_runningAlgorithm;
+    std::mutex m_streamMutex;
+    SolutionStore m_pendingSolutions;
+    std::optional<SolveProgress> m_pendingProgress;
+    QTimer* m_flushTimer;
+
     // (UI Widgets are unchanged)
     QTextEdit* m_numbersInput;
     QLineEdit* m_targetInput;
     QComboBox* m_algorithmSelector;
     QPushButton* m_solveButton;
-    QTextBrowser* m_resultsDisplay;
+    QPushButton* m_cancelButton;
+    QCheckBox* m_findAllCheck;
+    QProgressBar* m_progressBar;
+    QLabel* m_progressLabel;
+    QTextBrowser* m_resultsDisplay;  // run summary
+    QListView* m_solutionsView;
+    SolutionListModel* m_solutionsModel;
+    QLineEdit* m_filterInput;
+    QComboBox* m_sortSelector;
+    BenchmarkPanel* m_benchmarkPanel;
     QPushButton* m_saveButton;
 };
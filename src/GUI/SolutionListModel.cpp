@@ -0,0 +1,163 @@
+// src/GUI/SolutionListModel.cpp
+#include "SolutionListModel.h"
+#include <algorithm>
+
+SolutionListModel::SolutionListModel(QObject* parent)
+    : QAbstractListModel(parent) {}
+
+int SolutionListModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_exposed);
+}
+
+QVariant SolutionListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || static_cast<std::size_t>(index.row()) >= m_exposed) return QVariant();
+    const std::size_t id = solutionAt(index.row());
+    const SolutionStore::Subset subset = m_store[id];
+    if (role == Qt::DisplayRole) {
+        // Built on demand: only rows the view paints ever get a string.
+        QString text = QString("#%1: { ").arg(static_cast<qulonglong>(id + 1));
+        for (std::size_t i = 0; i < subset.size(); ++i) {
+            if (i > 0) text += ", ";
+            text += QString::number(subset[i]);
+        }
+        return text + " }";
+    }
+    if (role == Qt::ToolTipRole) return QString("%1 numbers").arg(static_cast<qulonglong>(subset.size()));
+    return QVariant();
+}
+
+bool SolutionListModel::canFetchMore(const QModelIndex& parent) const
+{
+    if (parent.isValid()) return false;
+    if (!filtered() && !sorted()) return m_exposed < m_store.size();
+    if (!sorted()) return m_exposed < m_rows.size() || m_scanned < m_store.size();
+    return m_exposed < m_rows.size();
+}
+
+void SolutionListModel::fetchMore(const QModelIndex& parent)
+{
+    if (parent.isValid()) return;
+    const std::size_t available = prepareRows(m_exposed + kFetchChunk);
+    if (available <= m_exposed) return;
+    beginInsertRows(QModelIndex(), static_cast<int>(m_exposed), static_cast<int>(available - 1));
+    m_exposed = available;
+    endInsertRows();
+}
+
+void SolutionListModel::appendSolutions(SolutionStore& batch)
+{
+    const std::size_t first_new = m_store.size();
+    if (m_store.empty()) m_store.swap(batch);
+    else m_store.append(batch);
+    batch.clear();
+
+    // Sorting needs every candidate up front; filtering picks new ids up lazily.
+    if (sorted()) {
+        // New ids may belong inside the prefix that is already in order and
+        // shown, so start the sorted view over.
+        if (m_ordered > 0) {
+            rebuildView();
+            return;
+        }
+        for (std::size_t id = first_new; id < m_store.size(); ++id) {
+            if (passesFilter(id)) m_rows.push_back(id);
+        }
+        m_scanned = m_store.size();
+    }
+    // Views only ask for more rows while scrolling, so fill the first screen here.
+    if (m_exposed < kFetchChunk && canFetchMore(QModelIndex())) fetchMore(QModelIndex());
+}
+
+void SolutionListModel::clear()
+{
+    m_store.clear();
+    rebuildView();
+}
+
+void SolutionListModel::setFilter(std::optional<int> must_contain)
+{
+    m_filter = must_contain;
+    rebuildView();
+}
+
+void SolutionListModel::setOrdering(SortKey key, Qt::SortOrder order)
+{
+    m_sortKey = key;
+    m_sortOrder = order;
+    rebuildView();
+}
+
+bool SolutionListModel::passesFilter(std::size_t id) const
+{
+    if (!m_filter) return true;
+    const SolutionStore::Subset subset = m_store[id];
+    return std::find(subset.begin(), subset.end(), *m_filter) != subset.end();
+}
+
+// Strict weak order for the current key and direction; ties keep discovery order.
+bool SolutionListModel::lessThan(std::size_t a, std::size_t b) const
+{
+    const SolutionStore::Subset x = m_store[a];
+    const SolutionStore::Subset y = m_store[b];
+    bool before = false, after = false;
+    if (m_sortKey == SortKey::Size) {
+        before = x.size() < y.size();
+        after = y.size() < x.size();
+    } else {
+        before = std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+        after = std::lexicographical_compare(y.begin(), y.end(), x.begin(), x.end());
+    }
+    if (m_sortOrder == Qt::DescendingOrder) std::swap(before, after);
+    return before || (!after && a < b);
+}
+
+std::size_t SolutionListModel::solutionAt(int row) const
+{
+    const std::size_t r = static_cast<std::size_t>(row);
+    return filtered() || sorted() ? m_rows[r] : r;
+}
+
+std::size_t SolutionListModel::prepareRows(std::size_t rows)
+{
+    if (!filtered() && !sorted()) return std::min(rows, m_store.size());
+
+    if (!sorted()) {
+        while (m_rows.size() < rows && m_scanned < m_store.size()) {
+            if (passesFilter(m_scanned)) m_rows.push_back(m_scanned);
+            ++m_scanned;
+        }
+        return std::min(rows, m_rows.size());
+    }
+
+    // Incremental sort: move the next chunk's elements into place with a
+    // selection pass over the unordered tail, then sort only that chunk.
+    const std::size_t want = std::min(rows, m_rows.size());
+    if (want > m_ordered) {
+        auto less = [this](std::size_t a, std::size_t b) { return lessThan(a, b); };
+        const auto first = m_rows.begin() + static_cast<std::ptrdiff_t>(m_ordered);
+        const auto nth = m_rows.begin() + static_cast<std::ptrdiff_t>(want);
+        std::nth_element(first, nth, m_rows.end(), less);
+        std::sort(first, nth, less);
+        m_ordered = want;
+    }
+    return want;
+}
+
+void SolutionListModel::rebuildView()
+{
+    beginResetModel();
+    m_rows.clear();
+    m_scanned = 0;
+    m_ordered = 0;
+    m_exposed = 0;
+    if (sorted()) {
+        for (std::size_t id = 0; id < m_store.size(); ++id) {
+            if (passesFilter(id)) m_rows.push_back(id);
+        }
+        m_scanned = m_store.size();
+    }
+    endResetModel();
+    if (canFetchMore(QModelIndex())) fetchMore(QModelIndex());
+}
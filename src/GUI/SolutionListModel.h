@@ -0,0 +1,68 @@
+// src/GUI/SolutionListModel.h
+#pragma once
+
+#include <QAbstractListModel>
+#include "DataModel/SolutionStore.h"
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// List model over a SolutionStore that stays cheap with millions of rows.
+// Rows are exposed in chunks through canFetchMore()/fetchMore(), so the view
+// only asks for what it scrolls to. Filtering scans the store lazily as rows
+// are fetched, and sorting orders one chunk at a time (select the chunk, then
+// sort just that chunk) instead of sorting everything up front.
+class SolutionListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum class SortKey {
+        None,          // order of discovery
+        Size,          // number of items in the subset
+        Lexicographic  // element by element
+    };
+
+    explicit SolutionListModel(QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+    // Takes the solutions out of `batch`, leaving it empty.
+    void appendSolutions(SolutionStore& batch);
+    void clear();
+
+    // Only show subsets containing this number; nullopt shows everything.
+    void setFilter(std::optional<int> must_contain);
+    void setOrdering(SortKey key, Qt::SortOrder order);
+
+    const SolutionStore& store() const { return m_store; }
+    std::size_t totalSolutions() const { return m_store.size(); }
+
+private:
+    static constexpr std::size_t kFetchChunk = 1000;
+
+    bool filtered() const { return m_filter.has_value(); }
+    bool sorted() const { return m_sortKey != SortKey::None; }
+    bool passesFilter(std::size_t id) const;
+    bool lessThan(std::size_t a, std::size_t b) const;
+    std::size_t solutionAt(int row) const;
+    // Makes at least `rows` leading rows final (filtered and, if sorting,
+    // in order) and returns how many are available.
+    std::size_t prepareRows(std::size_t rows);
+    void rebuildView();
+
+    SolutionStore m_store;
+    std::optional<int> m_filter;
+    SortKey m_sortKey = SortKey::None;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+
+    // Store ids in display order; unused (identity) when neither filtering
+    // nor sorting. With sorting, m_rows[0, m_ordered) is final.
+    std::vector<std::size_t> m_rows;
+    std::size_t m_scanned = 0;  // store ids already tested by the filter
+    std::size_t m_ordered = 0;
+    std::size_t m_exposed = 0;  // rows announced to the view
+};
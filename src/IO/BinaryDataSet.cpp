@@ -0,0 +1,157 @@
+// src/IO/BinaryDataSet.cpp
+#include "BinaryDataSet.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace binary_dataset {
+
+namespace {
+
+constexpr std::uint8_t kKnownFlags = kHasValues | kHasChecksum | kCardinalityExactly | kCardinalityAtMost;
+
+bool hostIsLittleEndian() {
+    const std::uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+std::uint64_t readLE(const char* p, unsigned bytes) {
+    std::uint64_t value = 0;
+    for (unsigned i = 0; i < bytes; ++i) value |= std::uint64_t(static_cast<unsigned char>(p[i])) << (8 * i);
+    return value;
+}
+
+void appendLE(std::string& out, std::uint64_t value, unsigned bytes) {
+    for (unsigned i = 0; i < bytes; ++i) out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+// Sign-extends the low `width` bytes of `raw`.
+int signedItem(std::uint64_t raw, unsigned width) {
+    const unsigned shift = 64 - 8 * width;
+    return static_cast<int>(static_cast<std::int64_t>(raw << shift) >> shift);
+}
+
+std::uint64_t fnv1a(const char* data, std::size_t size) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+unsigned narrowestWidth(Span<const int> items, unsigned width) {
+    for (const int x : items) {
+        if (width < 4 && (x < std::numeric_limits<std::int16_t>::min() || x > std::numeric_limits<std::int16_t>::max())) {
+            return 4;
+        }
+        if (width < 2 && (x < std::numeric_limits<std::int8_t>::min() || x > std::numeric_limits<std::int8_t>::max())) {
+            width = 2;
+        }
+    }
+    return width;
+}
+
+std::size_t paddedSize(std::size_t payload) {
+    return (payload + 7) / 8 * 8;
+}
+
+} // namespace
+
+bool hasMagic(std::string_view bytes) {
+    return bytes.size() >= sizeof(kMagic) && std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+void writeRecord(std::ostream& out, const DataSetView& data, bool with_checksum) {
+    const bool has_values = !data.values.empty();
+    if (has_values && data.values.size() != data.numbers.size()) {
+        throw std::invalid_argument("Need exactly one value per number.");
+    }
+    const unsigned width = narrowestWidth(data.values, narrowestWidth(data.numbers, 1));
+
+    std::string payload;
+    payload.reserve(paddedSize(data.numbers.size() * width * (has_values ? 2 : 1)));
+    for (const int x : data.numbers) appendLE(payload, static_cast<std::uint32_t>(x), width);
+    for (const int x : data.values) appendLE(payload, static_cast<std::uint32_t>(x), width);
+    const std::size_t checked_bytes = payload.size();
+    payload.resize(paddedSize(payload.size()), '\0');
+
+    std::uint8_t flags = 0;
+    if (has_values) flags |= kHasValues;
+    if (with_checksum) flags |= kHasChecksum;
+    if (data.cardinality == CardinalityRule::Exactly) flags |= kCardinalityExactly;
+    if (data.cardinality == CardinalityRule::AtMost) flags |= kCardinalityAtMost;
+
+    std::string header(kMagic, sizeof(kMagic));
+    appendLE(header, kVersion, 2);
+    appendLE(header, width, 1);
+    appendLE(header, flags, 1);
+    appendLE(header, data.numbers.size(), 8);
+    appendLE(header, static_cast<std::uint32_t>(data.target_sum), 4);
+    appendLE(header, static_cast<std::uint32_t>(data.cardinality_k), 4);
+    appendLE(header, with_checksum ? fnv1a(payload.data(), checked_bytes) : 0, 8);
+
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!out) throw std::runtime_error("Could not write binary dataset record.");
+}
+
+RecordReader::RecordReader(std::string_view bytes, std::string source)
+    : m_bytes(bytes), m_source(std::move(source)) {}
+
+bool RecordReader::next(DataSetView& out) {
+    if (atEnd()) return false;
+    const std::size_t start = m_pos;
+    auto fail = [&](const std::string& reason) {
+        throw std::runtime_error(m_source + ": " + reason + " in the record at byte " + std::to_string(start));
+    };
+
+    const char* header = m_bytes.data() + start;
+    const std::size_t remaining = m_bytes.size() - start;
+    if (remaining < kHeaderSize) fail("truncated header");
+    if (!hasMagic(std::string_view(header, remaining))) fail("not a binary dataset record (bad magic)");
+    const auto version = static_cast<std::uint16_t>(readLE(header + 4, 2));
+    if (version != kVersion) fail("unsupported format version " + std::to_string(version));
+    const unsigned width = static_cast<unsigned>(readLE(header + 6, 1));
+    if (width != 1 && width != 2 && width != 4) fail("invalid element width " + std::to_string(width));
+    const auto flags = static_cast<std::uint8_t>(readLE(header + 7, 1));
+    if (flags & ~kKnownFlags) fail("unknown flags");
+    if ((flags & kCardinalityExactly) && (flags & kCardinalityAtMost)) fail("conflicting cardinality flags");
+    const std::uint64_t count = readLE(header + 8, 8);
+
+    const std::size_t arrays = (flags & kHasValues) ? 2 : 1;
+    const std::size_t available = remaining - kHeaderSize;
+    if (count > available / (width * arrays)) fail("truncated payload");
+    const std::size_t payload_bytes = static_cast<std::size_t>(count) * width * arrays;
+    const char* payload = header + kHeaderSize;
+    if ((flags & kHasChecksum) && fnv1a(payload, payload_bytes) != readLE(header + 24, 8)) fail("checksum mismatch");
+
+    const std::size_t n = static_cast<std::size_t>(count);
+    out = DataSetView(items(payload, n, width, m_numbers), signedItem(readLE(header + 16, 4), 4));
+    out.cardinality_k = signedItem(readLE(header + 20, 4), 4);
+    if (flags & kCardinalityExactly) out.cardinality = CardinalityRule::Exactly;
+    else if (flags & kCardinalityAtMost) out.cardinality = CardinalityRule::AtMost;
+    if (flags & kHasValues) out.values = items(payload + n * width, n, width, m_values);
+
+    // The last record of a stream may omit its padding.
+    m_pos = start + kHeaderSize + std::min(paddedSize(payload_bytes), available);
+    ++m_records;
+    return true;
+}
+
+// 4-byte items already have the host layout on little-endian machines, so the
+// view points straight into the stream; anything else is decoded into `scratch`.
+Span<const int> RecordReader::items(const char* first, std::size_t count, unsigned width, std::vector<int>& scratch) {
+    if (width == sizeof(int) && hostIsLittleEndian() && reinterpret_cast<std::uintptr_t>(first) % alignof(int) == 0) {
+        return Span<const int>(reinterpret_cast<const int*>(first), count);
+    }
+    scratch.resize(count);
+    for (std::size_t i = 0; i < count; ++i) scratch[i] = signedItem(readLE(first + i * width, width), width);
+    return Span<const int>(scratch.data(), count);
+}
+
+} // namespace binary_dataset
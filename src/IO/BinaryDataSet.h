@@ -0,0 +1,76 @@
+// src/IO/BinaryDataSet.h
+#pragma once
+
+#include "DataModel/DataSetView.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Binary dataset format, version 1. A stream is any number of records back to
+// back; each record is a 32-byte header followed by its payload, all
+// little-endian:
+//
+//   offset  size  field
+//        0     4  magic "SSDS"
+//        4     2  version (1)
+//        6     1  element width in bytes: 1, 2 or 4 (signed integers)
+//        7     1  flags (kHasValues | kHasChecksum | cardinality rule)
+//        8     8  n, the number of items
+//       16     4  target sum
+//       20     4  cardinality k
+//       24     8  FNV-1a 64 of the payload, or 0 without kHasChecksum
+//
+// The payload is the n numbers, then n knapsack values if kHasValues, zero
+// padded to a multiple of 8 bytes so that every record in a stream stays
+// aligned. Records with 4-byte items read on a little-endian host are used in
+// place; narrower items are widened into a scratch buffer.
+namespace binary_dataset {
+
+constexpr char kMagic[4] = {'S', 'S', 'D', 'S'};
+constexpr std::uint16_t kVersion = 1;
+constexpr std::size_t kHeaderSize = 32;
+
+enum Flags : std::uint8_t {
+    kHasValues = 1 << 0,
+    kHasChecksum = 1 << 1,
+    kCardinalityExactly = 1 << 2,
+    kCardinalityAtMost = 1 << 3,
+};
+
+// True if `bytes` starts with a binary record (as opposed to text input).
+bool hasMagic(std::string_view bytes);
+
+// Appends one record for `data`, using the narrowest element width that holds
+// every number and value.
+void writeRecord(std::ostream& out, const DataSetView& data, bool with_checksum = true);
+
+// Walks the records of a stream held in memory, typically a MappedFile. Throws
+// std::runtime_error naming the record's byte offset when one is malformed,
+// truncated or fails its checksum.
+class RecordReader {
+public:
+    // `source` prefixes error messages; `bytes` must outlive the reader.
+    RecordReader(std::string_view bytes, std::string source);
+
+    // Decodes the next record into `out`, which stays valid until the next
+    // call. Returns false at the end of the stream.
+    bool next(DataSetView& out);
+
+    bool atEnd() const { return m_pos == m_bytes.size(); }
+    std::size_t recordsRead() const { return m_records; }
+
+private:
+    Span<const int> items(const char* first, std::size_t count, unsigned width, std::vector<int>& scratch);
+
+    std::string_view m_bytes;
+    std::string m_source;
+    std::size_t m_pos = 0;
+    std::size_t m_records = 0;
+    std::vector<int> m_numbers;  // widened items when they cannot be used in place
+    std::vector<int> m_values;
+};
+
+} // namespace binary_dataset
@@ -0,0 +1,76 @@
+// src/IO/DataSetLoader.cpp
+#include "DataSetLoader.h"
+#include "BinaryDataSet.h"
+#include "MappedFile.h"
+#include "Parsing/NumberParser.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace dataset_loader {
+
+DataSet loadTextFile(const std::string& path) {
+    const MappedFile file(path);
+    return parseText(file.view(), path);
+}
+
+DataSet loadFile(const std::string& path) {
+    const MappedFile file(path);
+    if (!binary_dataset::hasMagic(file.view())) return parseText(file.view(), path);
+
+    binary_dataset::RecordReader reader(file.view(), path);
+    DataSetView view;
+    reader.next(view);
+    if (!reader.atEnd()) throw std::runtime_error(path + " holds several records; read it with --batch.");
+    DataSet data;
+    data.numbers.assign(view.numbers.begin(), view.numbers.end());
+    data.target_sum = view.target_sum;
+    data.cardinality = view.cardinality;
+    data.cardinality_k = view.cardinality_k;
+    data.values.assign(view.values.begin(), view.values.end());
+    return data;
+}
+
+DataSet parseText(std::string_view text, const std::string& source) {
+    // Line views into the buffer; parse errors are re-anchored to the whole text.
+    std::size_t pos = 0;
+    auto next_line = [&](std::string_view& line) {
+        if (pos >= text.size()) return false;
+        const std::size_t eol = std::min(text.find('\n', pos), text.size());
+        line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+        return true;
+    };
+    auto in_text = [&](std::string_view line, auto parse) {
+        try {
+            return parse(line);
+        } catch (const ParseError& e) {
+            throw ParseError(source + ": " + e.reason(), static_cast<std::size_t>(line.data() - text.data()) + e.offset(),
+                             text);
+        }
+    };
+
+    DataSet data;
+    std::string_view line;
+    if (!next_line(line)) throw std::runtime_error("File is empty or could not read numbers line.");
+    data.numbers = in_text(line, [](std::string_view l) { return number_parser::parseList(l); });
+    if (!next_line(line)) throw std::runtime_error("Could not read target sum from file.");
+    data.target_sum = in_text(line, [](std::string_view l) { return number_parser::parseInteger(l); });
+    // Optional third line: knapsack values, one per number.
+    if (next_line(line) && line.find_first_not_of(" \t\r") != std::string_view::npos) {
+        data.values = in_text(line, [](std::string_view l) { return number_parser::parseList(l); });
+    }
+    return data;
+}
+
+void writeText(std::ostream& out, const DataSet& data) {
+    auto write_list = [&](const std::vector<int>& list) {
+        for (std::size_t i = 0; i < list.size(); ++i) out << (i == 0 ? "" : ",") << list[i];
+        out << '\n';
+    };
+    write_list(data.numbers);
+    out << data.target_sum << '\n';
+    if (!data.values.empty()) write_list(data.values);
+    if (!out) throw std::runtime_error("Could not write dataset.");
+}
+
+} // namespace dataset_loader
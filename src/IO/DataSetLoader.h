@@ -0,0 +1,27 @@
+// src/IO/DataSetLoader.h
+#pragma once
+
+#include "DataModel/DataSet.h"
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// Text dataset format: line 1 holds the comma-separated numbers, line 2 the
+// target sum and the optional line 3 the knapsack values.
+namespace dataset_loader {
+
+// Memory-maps `path` and parses it in place.
+DataSet loadTextFile(const std::string& path);
+
+// Loads a text or single-record binary file (see IO/BinaryDataSet.h), telling
+// them apart by the binary magic. Streams of several records need --batch.
+DataSet loadFile(const std::string& path);
+
+// Parses text already in memory; `source` prefixes error messages.
+DataSet parseText(std::string_view text, const std::string& source);
+
+// Writes `data` in the text format, the inverse of parseText (cardinality
+// rules have no text form and are dropped).
+void writeText(std::ostream& out, const DataSet& data);
+
+} // namespace dataset_loader
@@ -0,0 +1,100 @@
+// src/IO/MappedFile.cpp
+#include "MappedFile.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("Could not open file '" + path + "'");
+    m_file = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        release();
+        throw std::runtime_error("Could not read the size of '" + path + "'");
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if (m_size == 0) return;  // an empty mapping is not allowed; nothing to read anyway
+    m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping) m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_data) {
+        release();
+        throw std::runtime_error("Could not map file '" + path + "'");
+    }
+}
+
+void MappedFile::release() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file) CloseHandle(m_file);
+    m_data = nullptr;
+    m_mapping = nullptr;
+    m_file = nullptr;
+    m_size = 0;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Could not open file '" + path + "'");
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not read the size of '" + path + "'");
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    if (m_size != 0) {
+        void* mapped = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            m_size = 0;
+            throw std::runtime_error("Could not map file '" + path + "'");
+        }
+        // Inputs are parsed front to back once.
+        ::madvise(mapped, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(mapped);
+    }
+    ::close(fd);  // the mapping keeps the file referenced
+}
+
+void MappedFile::release() {
+    if (m_data) ::munmap(const_cast<char*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+#ifdef _WIN32
+        std::swap(m_file, other.m_file);
+        std::swap(m_mapping, other.m_mapping);
+#endif
+    }
+    return *this;
+}
@@ -0,0 +1,34 @@
+// src/IO/MappedFile.h
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only memory mapping of a whole file. Parsers read the mapping in
+// place, so loading a large input neither copies it into a buffer nor goes
+// through stream reads. Throws std::runtime_error if the file cannot be
+// opened or mapped.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    std::string_view view() const { return std::string_view(m_data, m_size); }
+
+private:
+    void release();
+
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE
+    void* m_mapping = nullptr;  // HANDLE
+#endif
+};
@@ -0,0 +1,151 @@
+// src/Parsing/NumberParser.cpp
+#include "NumberParser.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+namespace {
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// "line L, column C" of a byte offset, computed only when reporting an error.
+std::string describePosition(std::string_view text, std::size_t offset) {
+    std::size_t line = 1, column = 1;
+    for (std::size_t i = 0; i < offset && i < text.size(); ++i) {
+        if (text[i] == '\n') {
+            ++line;
+            column = 1;
+        } else {
+            ++column;
+        }
+    }
+    return "line " + std::to_string(line) + ", column " + std::to_string(column);
+}
+
+[[noreturn]] void fail(std::string_view text, std::size_t offset, const std::string& reason) {
+    throw ParseError(reason, offset, text);
+}
+
+// Parses the number starting at `p` (a '+' sign is accepted like std::stoi
+// does) and returns the position just past it. The number must be followed
+// by whitespace, the delimiter or the end of the text. `kind` names the
+// expected form in error messages.
+template <typename T>
+const char* parseOne(std::string_view text, const char* p, const char* end, char delimiter, T& value,
+                     const char* kind) {
+    const char* const start = p;
+    auto token_end = [&]() {
+        const char* stop = start;
+        while (stop != end && !isSpace(*stop) && *stop != delimiter) ++stop;
+        return stop == start ? start + 1 : stop;
+    };
+    if (p != end && *p == '+') ++p;
+    const std::from_chars_result parsed = std::from_chars(p, end, value);
+    if (parsed.ec == std::errc::result_out_of_range) {
+        fail(text, static_cast<std::size_t>(start - text.data()),
+             "Number '" + std::string(start, token_end()) + "' is out of range");
+    }
+    const bool valid = parsed.ec == std::errc() && !(p != start && *p == '-') &&
+                       (parsed.ptr == end || isSpace(*parsed.ptr) || *parsed.ptr == delimiter);
+    if (!valid) {
+        fail(text, static_cast<std::size_t>(start - text.data()),
+             "'" + std::string(start, token_end()) + "' is not a valid " + kind);
+    }
+    return parsed.ptr;
+}
+
+} // namespace
+
+ParseError::ParseError(const std::string& reason, std::size_t offset, std::string_view text)
+    : std::runtime_error(reason + " at " + describePosition(text, offset)), m_reason(reason), m_offset(offset) {}
+
+namespace number_parser {
+
+std::vector<int> parseList(std::string_view text, char delimiter) {
+    std::vector<int> numbers;
+    parseList(text, numbers, delimiter);
+    return numbers;
+}
+
+void parseList(std::string_view text, std::vector<int>& out, char delimiter) {
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    // One vectorizable pass over the delimiters sizes the output up front.
+    out.reserve(out.size() + static_cast<std::size_t>(std::count(p, end, delimiter)) + 1);
+    while (p != end && isSpace(*p)) ++p;
+    while (p != end) {
+        if (*p == delimiter) fail(text, static_cast<std::size_t>(p - text.data()), "Empty number");
+
+        // Fast path for plain "digits" tokens: up to 10 digits fit in 64 bits,
+        // so only the final value needs a range check. Signs, whitespace and
+        // errors fall back to the checked parser.
+        const char* q = p;
+        const char* const limit = q + std::min<std::ptrdiff_t>(10, end - q);
+        std::uint64_t fast = 0;
+        while (q != limit && static_cast<unsigned char>(*q - '0') < 10) fast = fast * 10 + static_cast<unsigned>(*q++ - '0');
+        if (q != p && (q == end || *q == delimiter) && fast <= static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+            out.push_back(static_cast<int>(fast));
+            p = q;
+        } else {
+            int value = 0;
+            p = parseOne(text, p, end, delimiter, value, "integer");
+            out.push_back(value);
+            while (p != end && isSpace(*p)) ++p;
+        }
+
+        if (p == end) break;
+        if (*p != delimiter) {
+            fail(text, static_cast<std::size_t>(p - text.data()),
+                 std::string("Expected '") + delimiter + "' but found '" + *p + "'");
+        }
+        ++p;
+        while (p != end && isSpace(*p)) ++p;
+    }
+}
+
+std::vector<double> parseDoubleList(std::string_view text, char delimiter) {
+    std::vector<double> numbers;
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    while (p != end && isSpace(*p)) ++p;
+    while (p != end) {
+        if (*p == delimiter) fail(text, static_cast<std::size_t>(p - text.data()), "Empty number");
+        const char* const start = p;
+        double value = 0.0;
+        p = parseOne(text, p, end, delimiter, value, "number");
+        if (!std::isfinite(value)) {
+            fail(text, static_cast<std::size_t>(start - text.data()),
+                 "'" + std::string(start, p) + "' is not a finite number");
+        }
+        numbers.push_back(value);
+        while (p != end && isSpace(*p)) ++p;
+
+        if (p == end) break;
+        if (*p != delimiter) {
+            fail(text, static_cast<std::size_t>(p - text.data()),
+                 std::string("Expected '") + delimiter + "' but found '" + *p + "'");
+        }
+        ++p;
+        while (p != end && isSpace(*p)) ++p;
+    }
+    return numbers;
+}
+
+int parseInteger(std::string_view text) {
+    const char* p = text.data();
+    const char* const end = p + text.size();
+    while (p != end && isSpace(*p)) ++p;
+    if (p == end) fail(text, text.size(), "Missing number");
+    int value = 0;
+    p = parseOne(text, p, end, '\0', value, "integer");
+    while (p != end && isSpace(*p)) ++p;
+    if (p != end) fail(text, static_cast<std::size_t>(p - text.data()), "Unexpected '" + std::string(1, *p) + "'");
+    return value;
+}
+
+} // namespace number_parser
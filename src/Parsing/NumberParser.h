@@ -0,0 +1,40 @@
+// src/Parsing/NumberParser.h
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Thrown for malformed input. offset() is the byte position of the
+// offending token in the parsed text; what() also gives it as line/column.
+class ParseError : public std::runtime_error {
+public:
+    ParseError(const std::string& reason, std::size_t offset, std::string_view text);
+    const std::string& reason() const { return m_reason; }
+    std::size_t offset() const { return m_offset; }
+
+private:
+    std::string m_reason;
+    std::size_t m_offset;
+};
+
+// Shared number parsing for the CLI, GUI and file loaders. Works directly on
+// a string_view with std::from_chars: no stream, no per-token string.
+namespace number_parser {
+
+// Parses a delimiter-separated list of integers such as "3, 34,4\n12".
+// Whitespace around tokens is ignored and one trailing delimiter is allowed;
+// empty tokens, junk and out-of-range values throw ParseError.
+std::vector<int> parseList(std::string_view text, char delimiter = ',');
+// Same, appending to `out` so callers can reuse its capacity.
+void parseList(std::string_view text, std::vector<int>& out, char delimiter = ',');
+
+// Same rules for decimal numbers such as "0.5, 1e3"; infinities and NaN throw.
+std::vector<double> parseDoubleList(std::string_view text, char delimiter = ',');
+
+// Parses one integer, ignoring surrounding whitespace.
+int parseInteger(std::string_view text);
+
+} // namespace number_parser
@@ -0,0 +1,159 @@
+// src/Workload/WorkloadGenerator.cpp
+#include "WorkloadGenerator.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace workload {
+
+namespace {
+
+// mt19937_64's output sequence is fixed by the standard; the conversions to
+// ranges below are ours, so results do not depend on the standard library.
+class Rng {
+public:
+    explicit Rng(std::uint64_t seed) : m_engine(seed) {}
+
+    // Uniform in [lo, hi], without modulo bias.
+    long long uniformInt(long long lo, long long hi) {
+        const std::uint64_t range = static_cast<std::uint64_t>(hi - lo) + 1;
+        if (range == 0) return static_cast<long long>(m_engine());  // the full 64-bit range
+        const std::uint64_t limit = UINT64_MAX - UINT64_MAX % range;
+        std::uint64_t draw;
+        do {
+            draw = m_engine();
+        } while (draw >= limit);
+        return lo + static_cast<long long>(draw % range);
+    }
+    // Uniform in (0, 1].
+    double uniformReal() { return (static_cast<double>(m_engine() >> 11) + 1.0) * 0x1.0p-53; }
+    double normal() {  // Box-Muller
+        // Separate statements: the order of two draws within one expression is unspecified.
+        const double u1 = uniformReal();
+        const double u2 = uniformReal();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+    bool chance(double p) { return uniformReal() <= p; }
+
+private:
+    std::mt19937_64 m_engine;
+};
+
+long long total(const std::vector<int>& numbers) {
+    return std::accumulate(numbers.begin(), numbers.end(), 0LL);
+}
+
+// Sum of a random subset (each item with probability 1/2), never empty.
+int subsetTarget(const std::vector<int>& numbers, Rng& rng) {
+    if (numbers.empty()) return 0;
+    long long sum = 0;
+    for (const int x : numbers) {
+        if (rng.chance(0.5)) sum += x;
+    }
+    if (sum == 0) sum = numbers[static_cast<std::size_t>(rng.uniformInt(0, static_cast<long long>(numbers.size()) - 1))];
+    return static_cast<int>(sum);
+}
+
+int clampToScale(double x, int scale) {
+    return static_cast<int>(std::clamp(std::llround(x), 1LL, static_cast<long long>(scale)));
+}
+
+} // namespace
+
+DataSet generate(const WorkloadSpec& spec) {
+    if (spec.scale < 1) throw std::invalid_argument("Workload scale must be at least 1.");
+    const std::size_t n = spec.n;
+    // Keep the total, and with it any target, within an int.
+    const int scale = n == 0 ? spec.scale : static_cast<int>(std::min<long long>(spec.scale, INT_MAX / static_cast<long long>(n)));
+    Rng rng(spec.seed);
+    DataSet data;
+    data.numbers.reserve(n);
+    auto fill = [&](auto draw) {
+        for (std::size_t i = 0; i < n; ++i) data.numbers.push_back(draw());
+    };
+    auto uniform = [&](long long lo, long long hi) { return static_cast<int>(rng.uniformInt(lo, hi)); };
+
+    switch (spec.family) {
+        case WorkloadFamily::Uniform:
+            fill([&] { return uniform(1, scale); });
+            data.target_sum = subsetTarget(data.numbers, rng);
+            break;
+        case WorkloadFamily::PowerLaw: {
+            // Pareto with alpha 1.16, the "80/20" exponent, floored at scale / 1000.
+            const double alpha = 1.16;
+            const double floor_value = std::max(1.0, scale / 1000.0);
+            fill([&] { return clampToScale(floor_value / std::pow(rng.uniformReal(), 1.0 / alpha), scale); });
+            data.target_sum = subsetTarget(data.numbers, rng);
+            break;
+        }
+        case WorkloadFamily::Duplicates: {
+            const std::size_t distinct = std::max<std::size_t>(2, static_cast<std::size_t>(std::sqrt(static_cast<double>(n))));
+            std::vector<int> pool(distinct);
+            for (int& x : pool) x = uniform(1, scale);
+            fill([&] { return pool[static_cast<std::size_t>(rng.uniformInt(0, static_cast<long long>(distinct) - 1))]; });
+            data.target_sum = subsetTarget(data.numbers, rng);
+            break;
+        }
+        case WorkloadFamily::HighDensity: {
+            const long long range = std::max<long long>(1, std::min<long long>(scale, static_cast<long long>(n)));
+            fill([&] { return uniform(1, range); });
+            data.target_sum = static_cast<int>(total(data.numbers) / 2);
+            break;
+        }
+        case WorkloadFamily::NoSolution: {
+            if (scale < 3) throw std::invalid_argument("The no-solution workload needs a scale of at least 3.");
+            fill([&] { return 3 * uniform(1, std::max(1, scale / 3)); });
+            const long long half = total(data.numbers) / 2;
+            data.target_sum = static_cast<int>(half - half % 3 + 1);
+            break;
+        }
+        case WorkloadFamily::Chvatal:
+            fill([&] { return uniform(1, scale); });
+            data.target_sum = static_cast<int>(total(data.numbers) / 2);
+            break;
+        case WorkloadFamily::EvenOdd:
+            if (scale < 2) throw std::invalid_argument("The even-odd workload needs a scale of at least 2.");
+            fill([&] { return 2 * uniform(1, std::max(1, scale / 2)); });
+            data.target_sum = static_cast<int>((total(data.numbers) / 2) | 1);
+            break;
+        case WorkloadFamily::Ledger: {
+            // Amounts in cents: log-normal line items around scale / 200, one
+            // in twenty a large entry, many rounded to whole or five dollars.
+            const double median = std::max(1.0, scale / 200.0);
+            fill([&] {
+                double amount = rng.chance(0.05) ? static_cast<double>(uniform(std::max(1, scale / 10), scale))
+                                                 : median * std::exp(1.2 * rng.normal());
+                const double roll = rng.uniformReal();
+                if (roll <= 0.2 && amount >= 500) amount = std::round(amount / 500) * 500;
+                else if (roll <= 0.5 && amount >= 100) amount = std::round(amount / 100) * 100;
+                return clampToScale(amount, scale);
+            });
+            data.target_sum = subsetTarget(data.numbers, rng);
+            break;
+        }
+    }
+    if (spec.target) data.target_sum = *spec.target;
+    return data;
+}
+
+const std::vector<std::string>& familyNames() {
+    static const std::vector<std::string> names = {"uniform", "power-law", "duplicates", "high-density",
+                                                   "no-solution", "chvatal", "even-odd", "ledger"};
+    return names;
+}
+
+WorkloadFamily familyFromName(const std::string& name) {
+    const auto& names = familyNames();
+    const auto it = std::find(names.begin(), names.end(), name);
+    if (it == names.end()) throw std::invalid_argument("Unknown workload family '" + name + "'.");
+    return static_cast<WorkloadFamily>(it - names.begin());
+}
+
+std::string familyName(WorkloadFamily family) {
+    return familyNames()[static_cast<std::size_t>(family)];
+}
+
+} // namespace workload
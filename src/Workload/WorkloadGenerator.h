@@ -0,0 +1,55 @@
+// src/Workload/WorkloadGenerator.h
+#pragma once
+
+#include "DataModel/DataSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Instance families for tests and benchmarks.
+enum class WorkloadFamily {
+    Uniform,      // numbers uniform in [1, scale]; target is a random subset's sum
+    PowerLaw,     // Pareto-distributed budgets (a few large, many small); subset-sum target
+    Duplicates,   // drawn from about sqrt(n) distinct values; subset-sum target
+    HighDensity,  // n numbers from a range no wider than n, so almost every sum is reachable
+    NoSolution,   // multiples of 3 with a target of 1 mod 3 near half the total: unsolvable,
+                  // and exact engines must exhaust their whole search to prove it
+    Chvatal,      // Chvatal's family: uniform numbers, target half the total; hard for
+                  // the DP engines when scale is large (Chvatal used 10^(n/2))
+    EvenOdd,      // even numbers and an odd target (Pisinger's even-odd): unsolvable
+    Ledger        // budget-ledger amounts in cents: log-normal line items with
+                  // round-number bias and a few large entries; subset-sum target
+};
+
+struct WorkloadSpec {
+    WorkloadFamily family = WorkloadFamily::Uniform;
+    std::size_t n = 100;
+    // Largest number to generate. Families that need the target to fit in an
+    // int lower it so that n * scale does not overflow.
+    int scale = 1000;
+    std::uint64_t seed = 1;
+    // Overrides the family's own target.
+    std::optional<int> target;
+};
+
+// Seeded, reproducible generation. The draws do not go through std::
+// distributions, whose output is implementation-defined, so the integer-only
+// families give the same instance on every platform. Power-law and ledger
+// also go through std::pow, std::log, std::cos and std::exp, whose last bits
+// may differ between math libraries; they are reproducible on one platform
+// but may differ by a rounding step across platforms.
+namespace workload {
+
+// Throws std::invalid_argument when scale is below 1, or below the smallest
+// number the family draws (3 for no-solution, 2 for even-odd).
+DataSet generate(const WorkloadSpec& spec);
+
+// Family names as used on the command line ("uniform", "power-law", ...).
+const std::vector<std::string>& familyNames();
+// Throws std::invalid_argument for an unknown name.
+WorkloadFamily familyFromName(const std::string& name);
+std::string familyName(WorkloadFamily family);
+
+} // namespace workload
@@ -0,0 +1,177 @@
+// src/main_bench_sweep.cpp
+// bench_sweep: runs every engine over a grid of generated instances and
+// writes one row per (engine, n, target, density) as CSV and/or JSON.
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cxxopts.hpp"
+#include "include/json.hpp"
+#include "Benchmarking/Baseline.h"
+#include "Benchmarking/ReportWriter.h"
+#include "Benchmarking/ScalingSweep.h"
+#include "Parsing/NumberParser.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> parse_int_list(const std::string& text) {
+    std::vector<T> list;
+    for (const int x : number_parser::parseList(text)) {
+        if (x < 0) throw std::runtime_error("Negative value in list '" + text + "'.");
+        list.push_back(static_cast<T>(x));
+    }
+    return list;
+}
+
+std::vector<double> parse_density_list(const std::string& text) {
+    std::vector<double> list = number_parser::parseDoubleList(text);
+    for (const double x : list) {
+        if (x <= 0.0) throw std::runtime_error("Non-positive density in list '" + text + "'.");
+    }
+    return list;
+}
+
+std::optional<double> per_run(const std::optional<std::uint64_t>& total, int runs) {
+    if (!total || runs == 0) return std::nullopt;
+    return static_cast<double>(*total) / runs;
+}
+
+// Column name and value of every metric, shared by the CSV and JSON writers.
+ReportRow metrics(const SweepPoint& point, const std::string& family) {
+    const BenchmarkResult& bench = point.bench;
+    const bool measured = bench.iterations > 0;
+    auto optional = [](const auto& value) { return value ? nlohmann::json(*value) : nlohmann::json(); };
+    auto if_measured = [&](double value) { return measured ? nlohmann::json(value) : nlohmann::json(); };
+    std::optional<PerfCounts> perf = measured ? bench.perf : std::nullopt;
+    const double cells = bench.cells_per_run * bench.iterations;
+    std::vector<std::pair<std::string, nlohmann::json>> columns{
+        {"engine", point.engine},
+        {"family", family},
+        {"n", point.n},
+        {"target", point.target},
+        {"density", point.density},
+        {"scale", point.scale},
+        {"outcome", scaling_sweep::outcomeName(point.outcome)},
+        {"iterations", bench.iterations},
+        {"solutions_found", bench.solutions_found_count},
+        {"mean_ms", if_measured(bench.stats.mean)},
+        {"p50_ms", if_measured(bench.stats.p50)},
+        {"p90_ms", if_measured(bench.stats.p90)},
+        {"p99_ms", if_measured(bench.stats.p99)},
+        {"max_ms", if_measured(bench.stats.max)},
+        {"stddev_ms", if_measured(bench.stats.stddev)},
+        {"ci95_low_ms", if_measured(bench.stats.ci95_low)},
+        {"ci95_high_ms", if_measured(bench.stats.ci95_high)},
+        {"allocations_per_run", bench.memory ? nlohmann::json(bench.memory->allocations) : nlohmann::json()},
+        {"allocated_bytes_per_run", bench.memory ? nlohmann::json(bench.memory->allocated_bytes) : nlohmann::json()},
+        {"peak_heap_bytes", bench.memory ? nlohmann::json(bench.memory->peak_heap_bytes) : nlohmann::json()},
+        {"peak_rss_bytes", optional(bench.peak_rss_bytes)},
+        {"cycles_per_run", perf ? optional(per_run(perf->cycles, bench.iterations)) : nlohmann::json()},
+        {"instructions_per_run", perf ? optional(per_run(perf->instructions, bench.iterations)) : nlohmann::json()},
+        {"ipc", perf ? optional(perf->ipc()) : nlohmann::json()},
+        {"llc_misses_per_million_cells", perf ? optional(perf->llcMissesPerMillionCells(cells)) : nlohmann::json()},
+        {"branch_miss_rate", perf ? optional(perf->branchMissRate()) : nlohmann::json()},
+    };
+    for (std::size_t p = 0; p < kSolvePhaseCount; ++p) {
+        const SolvePhase phase = static_cast<SolvePhase>(p);
+        columns.emplace_back(std::string(phaseName(phase)) + "_ms",
+                             measured && bench.phases ? nlohmann::json((*bench.phases)[phase]) : nlohmann::json());
+    }
+    columns.emplace_back("error", point.error);
+    return columns;
+}
+
+// Baseline case of a grid point; stable across runs with the same grid.
+std::string case_name(const SweepPoint& point, const std::string& family) {
+    std::ostringstream name;
+    name << point.engine << " " << family << " n=" << point.n << " target=" << point.target << " density=" << point.density;
+    return name.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options("bench_sweep", "Runs every engine over a grid of generated instances.");
+    options.add_options()
+        ("sizes", "Comma-separated item counts n", cxxopts::value<std::string>()->default_value("10,20,40,80"))
+        ("targets", "Comma-separated target sums", cxxopts::value<std::string>()->default_value("1000,10000,100000"))
+        ("densities", "Comma-separated densities n / log2(max number)", cxxopts::value<std::string>()->default_value("0.5,1,2"))
+        ("engines", "Comma-separated engines (default: every registered engine)", cxxopts::value<std::string>())
+        ("family", "Generator family for the numbers", cxxopts::value<std::string>()->default_value("uniform"))
+        ("seed", "Generator seed", cxxopts::value<std::uint64_t>()->default_value("1"))
+        ("iterations", "Measured runs per grid point", cxxopts::value<int>()->default_value("3"))
+        ("warmup", "Unmeasured runs per grid point", cxxopts::value<int>()->default_value("1"))
+        ("timeout-ms", "Per-solve timeout; engines that hit it skip larger n", cxxopts::value<int>()->default_value("1000"))
+        ("perf-counters", "Record hardware counters (Linux)", cxxopts::value<bool>()->default_value("false"))
+        ("phases", "Record per-phase times (dp, sparse, knapsack-dp)", cxxopts::value<bool>()->default_value("false"))
+        ("save-baseline", "Save every grid point's samples to this baseline file", cxxopts::value<std::string>())
+        ("baseline-name", "Name recorded by --save-baseline", cxxopts::value<std::string>()->default_value("baseline"))
+        ("compare-baseline", "Compare with this baseline file; exit status 2 on a regression", cxxopts::value<std::string>())
+        ("regression-threshold", "Slowdown in percent reported as a regression", cxxopts::value<double>()->default_value("5"))
+        ("csv", "CSV output path ('-' for stdout)", cxxopts::value<std::string>())
+        ("json", "JSON output path ('-' for stdout)", cxxopts::value<std::string>())
+        ("h,help", "Print usage");
+
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return 0;
+        }
+
+        SweepConfig config;
+        config.sizes = parse_int_list<std::size_t>(result["sizes"].as<std::string>());
+        config.targets = parse_int_list<int>(result["targets"].as<std::string>());
+        config.densities = parse_density_list(result["densities"].as<std::string>());
+        if (result.count("engines")) {
+            std::stringstream engines(result["engines"].as<std::string>());
+            std::string engine;
+            while (std::getline(engines, engine, ',')) config.engines.push_back(engine);
+        }
+        const std::string family = result["family"].as<std::string>();
+        config.family = workload::familyFromName(family);
+        config.seed = result["seed"].as<std::uint64_t>();
+        config.iterations = result["iterations"].as<int>();
+        config.warmup_iterations = result["warmup"].as<int>();
+        config.timeout = std::chrono::milliseconds(result["timeout-ms"].as<int>());
+        config.perf_counters = result["perf-counters"].as<bool>();
+        config.phase_timing = result["phases"].as<bool>();
+        if (config.iterations < 1 || config.warmup_iterations < 0 || config.timeout.count() <= 0) {
+            throw std::runtime_error("Iterations and timeout must be positive, warm-up non-negative.");
+        }
+        const bool csv = result.count("csv") > 0 || result.count("json") == 0;
+        const std::string csv_path = result.count("csv") ? result["csv"].as<std::string>() : "-";
+
+        std::ofstream csv_file;
+        ReportWriter report(csv ? &report_writer::openOutput(csv_path, csv_file) : nullptr);
+        Baseline current{result["baseline-name"].as<std::string>(), {}};
+        scaling_sweep::run(config, [&](const SweepPoint& point) {
+            if (point.outcome == SweepOutcome::Ok) current.put({case_name(point, family), point.bench.samples_ms});
+            std::cerr << point.engine << " n=" << point.n << " target=" << point.target << " density=" << point.density
+                      << ": " << scaling_sweep::outcomeName(point.outcome) << std::endl;
+            report.add(metrics(point, family));
+        });
+
+        if (result.count("json")) {
+            std::ofstream json_file;
+            report_writer::openOutput(result["json"].as<std::string>(), json_file) << report.rows().dump(2) << std::endl;
+        }
+        int regressions = 0;
+        if (result.count("compare-baseline")) {
+            const Baseline reference = baseline::load(result["compare-baseline"].as<std::string>());
+            const double threshold = result["regression-threshold"].as<double>() / 100.0;
+            regressions = baseline::writeReport(std::cerr, reference.name, baseline::compare(reference, current, threshold));
+        }
+        if (result.count("save-baseline")) baseline::save(result["save-baseline"].as<std::string>(), current);
+        if (regressions > 0) return 2;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// src/main_bench_throughput.cpp
+// bench_throughput: many small generated instances solved on 1..N threads;
+// writes solves/sec, latency percentiles and heap traffic per thread count
+// as CSV and/or JSON.
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cxxopts.hpp"
+#include "include/json.hpp"
+#include "Benchmarking/ReportWriter.h"
+#include "Benchmarking/ThroughputBenchmark.h"
+#include "Parsing/NumberParser.h"
+
+namespace {
+
+// 1, 2, 4, ... up to the hardware thread count (included).
+std::string default_thread_counts() {
+    const int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::string list;
+    int threads = 1;
+    for (; threads < hardware; threads *= 2) list += std::to_string(threads) + ",";
+    return list + std::to_string(hardware);
+}
+
+// Column name and value of every metric, shared by the CSV and JSON writers.
+ReportRow metrics(const ThroughputPoint& point, const ThroughputConfig& config) {
+    const BenchmarkStats& latency = point.latency;
+    const auto& per_thread = point.solves_per_thread;
+    const std::uint64_t fewest = per_thread.empty() ? 0 : *std::min_element(per_thread.begin(), per_thread.end());
+    const std::uint64_t most = per_thread.empty() ? 0 : *std::max_element(per_thread.begin(), per_thread.end());
+    return {
+        {"engine", config.engine},
+        {"family", workload::familyName(config.workload.family)},
+        {"n", config.workload.n},
+        {"threads", point.threads},
+        {"solves", point.solves},
+        {"solutions_found", point.solutions_found},
+        {"wall_ms", point.wall_ms},
+        {"solves_per_sec", point.solves_per_second},
+        {"efficiency", point.efficiency},
+        {"mean_ms", latency.mean},
+        {"p50_ms", latency.p50},
+        {"p90_ms", latency.p90},
+        {"p99_ms", latency.p99},
+        {"max_ms", latency.max},
+        {"allocations_per_solve", point.allocations_per_solve},
+        {"allocated_bytes_per_solve", point.allocated_bytes_per_solve},
+        {"min_thread_solves", fewest},
+        {"max_thread_solves", most},
+    };
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options("bench_throughput", "Solves many small instances in parallel at increasing thread counts.");
+    options.add_options()
+        ("engine", "Engine to run", cxxopts::value<std::string>()->default_value("dp"))
+        ("family", "Generator family for the instances", cxxopts::value<std::string>()->default_value("uniform"))
+        ("size", "Numbers per instance", cxxopts::value<std::size_t>()->default_value("20"))
+        ("scale", "Largest number", cxxopts::value<int>()->default_value("1000"))
+        ("seed", "Seed of the first instance", cxxopts::value<std::uint64_t>()->default_value("1"))
+        ("t,target", "Target for every instance (default: the family's own)", cxxopts::value<int>())
+        ("threads", "Comma-separated thread counts (default: powers of two up to the hardware threads)", cxxopts::value<std::string>())
+        ("instances", "Distinct instances per thread", cxxopts::value<std::size_t>()->default_value("64"))
+        ("duration-ms", "Measured time per thread count", cxxopts::value<int>()->default_value("1000"))
+        ("find-all", "Enumerate every solution", cxxopts::value<bool>()->default_value("false"))
+        ("csv", "CSV output path ('-' for stdout)", cxxopts::value<std::string>())
+        ("json", "JSON output path ('-' for stdout)", cxxopts::value<std::string>())
+        ("h,help", "Print usage");
+
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return 0;
+        }
+
+        ThroughputConfig config;
+        config.engine = result["engine"].as<std::string>();
+        config.workload.family = workload::familyFromName(result["family"].as<std::string>());
+        config.workload.n = result["size"].as<std::size_t>();
+        config.workload.scale = result["scale"].as<int>();
+        config.workload.seed = result["seed"].as<std::uint64_t>();
+        if (result.count("target")) config.workload.target = result["target"].as<int>();
+        config.thread_counts = number_parser::parseList(
+            result.count("threads") ? result["threads"].as<std::string>() : default_thread_counts());
+        config.instances_per_thread = result["instances"].as<std::size_t>();
+        config.duration = std::chrono::milliseconds(result["duration-ms"].as<int>());
+        config.find_all = result["find-all"].as<bool>();
+        const bool csv = result.count("csv") > 0 || result.count("json") == 0;
+        const std::string csv_path = result.count("csv") ? result["csv"].as<std::string>() : "-";
+
+        std::ofstream csv_file;
+        ReportWriter report(csv ? &report_writer::openOutput(csv_path, csv_file) : nullptr);
+        throughput_benchmark::run(config, [&](const ThroughputPoint& point) {
+            std::cerr << point.threads << " threads: " << point.solves_per_second << " solves/s (efficiency "
+                      << point.efficiency << "), p50 " << point.latency.p50 << " ms, p99 " << point.latency.p99
+                      << " ms, " << point.allocations_per_solve << " allocations/solve" << std::endl;
+            report.add(metrics(point, config));
+        });
+
+        if (result.count("json")) {
+            std::ofstream json_file;
+            report_writer::openOutput(result["json"].as<std::string>(), json_file) << report.rows().dump(2) << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,34 +1,83 @@
 // src/main.cpp
+#include <algorithm>
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <memory>
 #include <stdexcept>
-#include <fstream>
 #include <cstdio> // For popen
 
 #include "cxxopts.hpp"
 #include "include/json.hpp" // Include the new JSON header
 #include "AlgorithmSelector/SolverFactory.h"
+#include "CoreSolver/CountingSolver.h"
+#include "CoreSolver/ApproxSolver.h"
+#include "CoreSolver/GreedySolver.h"
+#include "CoreSolver/HybridSolver.h"
+#include "Benchmarking/AllocationTracker.h"
+#include "Benchmarking/Baseline.h"
 #include "Benchmarking/Benchmark.h"
+#include "Parsing/NumberParser.h"
+#include "IO/BinaryDataSet.h"
+#include "IO/DataSetLoader.h"
+#include "IO/MappedFile.h"
+#include "Workload/WorkloadGenerator.h"
 
 // (Helper functions are unchanged, they are included at the bottom)
 void print_solver_result(const SolverResult& result);
+void print_memory_usage(const MemoryUsage& memory, const char* per);
+void print_phase_times(const PhaseTimes& phases, const char* per);
 void print_benchmark_result(const BenchmarkResult& result);
+nlohmann::json benchmark_json(const std::string& algo_type, const BenchmarkResult& result);
+void print_batch_line(std::size_t record, const SolverResult& result);
+void generate_workload(const cxxopts::ParseResult& options);
 std::vector<int> parse_numbers_string(const std::string& s);
-DataSet parse_from_file(const std::string& filename);
+CountMode parse_count_mode(const std::string& s);
+const char* status_name(SolveStatus status);
+void print_progress(const SolveProgress& progress);
 
 int main(int argc, char** argv) {
     cxxopts::Options options("SubsetSumSolver", "A tool to solve the subset sum problem.");
 
     options.add_options()
-        ("a,algo", "Algorithm to use (dp, backtrack)", cxxopts::value<std::string>()->default_value("dp"))
+        ("a,algo", "Algorithm to use (dp, backtrack, sparse, count, knapsack, knapsack-dp, knapsack-bnb, knapsack-core, approx, greedy, hybrid)", cxxopts::value<std::string>()->default_value("dp"))
         ("n,numbers", "Comma-separated list of numbers", cxxopts::value<std::string>())
         ("t,target", "The target sum", cxxopts::value<int>())
-        ("f,file", "Path to an input file", cxxopts::value<std::string>())
-        ("find-all", "Find all possible subsets (backtrack only)", cxxopts::value<bool>()->default_value("false"))
-        ("b,benchmark", "Run benchmark N times", cxxopts::value<int>())
+        ("f,file", "Path to an input file (text or binary)", cxxopts::value<std::string>())
+        ("batch", "Solve every record of a binary dataset stream", cxxopts::value<std::string>())
+        ("convert", "Write the input as a binary dataset record to this path and exit", cxxopts::value<std::string>())
+        ("v,values", "Comma-separated value (priority) of each number, for knapsack mode", cxxopts::value<std::string>())
+        ("find-all", "Find all possible subsets (dp, backtrack)", cxxopts::value<bool>()->default_value("false"))
+        ("exactly", "Only accept subsets with exactly K numbers (dp, backtrack)", cxxopts::value<int>())
+        ("at-most", "Only accept subsets with at most K numbers (dp, backtrack)", cxxopts::value<int>())
+        ("count", "Only count the subsets that reach the target (no enumeration)", cxxopts::value<bool>()->default_value("false"))
+        ("count-mode", "Counter type for --count (u64, mod, big)", cxxopts::value<std::string>()->default_value("u64"))
+        ("modulus", "Modulus for --count-mode mod", cxxopts::value<std::uint64_t>()->default_value("1000000007"))
+        ("epsilon", "Approximation tolerance for --algo approx, in (0, 1)", cxxopts::value<double>()->default_value("0.01"))
+        ("time-budget-ms", "Wall-clock budget in ms for --algo greedy / hybrid", cxxopts::value<int>())
+        ("timeout-ms", "Stop any solver after this many ms and report its partial result", cxxopts::value<int>())
+        ("phases", "Time the allocate / preprocess / fill / reconstruct / output phases (dp, sparse, knapsack-dp)", cxxopts::value<bool>()->default_value("false"))
+        ("progress", "Print a live progress line to stderr while solving", cxxopts::value<bool>()->default_value("false"))
+        ("progress-interval-ms", "Milliseconds between --progress updates", cxxopts::value<int>()->default_value("250"))
+        ("generate", "Write a synthetic instance of this family instead of solving (uniform, power-law, duplicates, high-density, no-solution, chvatal, even-odd, ledger)", cxxopts::value<std::string>())
+        ("size", "Number of items for --generate", cxxopts::value<std::size_t>()->default_value("100"))
+        ("scale", "Largest number for --generate", cxxopts::value<int>()->default_value("1000"))
+        ("seed", "Random seed for --generate", cxxopts::value<std::uint64_t>()->default_value("1"))
+        ("records", "Instances for --generate to write (seeds seed, seed+1, ...; more than one needs --binary)", cxxopts::value<int>()->default_value("1"))
+        ("binary", "Write --generate output in the binary format", cxxopts::value<bool>()->default_value("false"))
+        ("o,output", "Output file for --generate (default: stdout)", cxxopts::value<std::string>())
+        ("b,benchmark", "Run benchmark N times (0: as many as --min-time-ms allows)", cxxopts::value<int>())
+        ("warmup", "Unmeasured warm-up runs before benchmarking", cxxopts::value<int>()->default_value("1"))
+        ("min-time-ms", "Keep benchmarking until the measured runs add up to this many ms", cxxopts::value<double>())
+        ("perf-counters", "Count cycles, instructions, LLC misses and branch misses per benchmark run (Linux)", cxxopts::value<bool>()->default_value("false"))
+        ("save-baseline", "Add the benchmark samples to this baseline file", cxxopts::value<std::string>())
+        ("baseline-name", "Name recorded by --save-baseline (e.g. a branch or commit)", cxxopts::value<std::string>()->default_value("baseline"))
+        ("compare-baseline", "Compare the benchmark with this baseline file; exit status 2 on a regression", cxxopts::value<std::string>())
+        ("case-name", "Case name in baseline files (default: algorithm, n and target)", cxxopts::value<std::string>())
+        ("regression-threshold", "Slowdown in percent that --compare-baseline reports as a regression", cxxopts::value<double>()->default_value("5"))
+        ("benchmark-json", "Also write the benchmark statistics and samples as JSON to this path ('-' for stdout)", cxxopts::value<std::string>())
         ("s,save", "Save the result to the database via Python handler", cxxopts::value<bool>()->default_value("false"))
         ("h,help", "Print usage");
     
@@ -39,33 +88,163 @@ int main(int argc, char** argv) {
             return 0;
         }
 
+        if (result.count("generate")) {
+            generate_workload(result);
+            return 0;
+        }
+
         DataSet problem_data;
         bool has_file = result.count("file") > 0;
         bool has_direct_input = result.count("numbers") > 0 && result.count("target") > 0;
+        bool batch_mode = result.count("batch") > 0;
         if (has_file && has_direct_input) throw std::runtime_error("Please provide input via --file OR --numbers/--target, not both.");
-        if (has_file) problem_data = parse_from_file(result["file"].as<std::string>());
+        if (batch_mode && (has_file || has_direct_input)) throw std::runtime_error("--batch reads its own input; drop --file/--numbers.");
+        if (batch_mode && (result.count("benchmark") || result.count("convert") || result["save"].as<bool>())) {
+            throw std::runtime_error("--batch cannot be combined with --benchmark, --convert or --save.");
+        }
+        if (batch_mode && (result.count("exactly") || result.count("at-most"))) {
+            throw std::runtime_error("--batch takes cardinality rules from each record; drop --exactly/--at-most.");
+        }
+        if (has_file) problem_data = dataset_loader::loadFile(result["file"].as<std::string>());
         else if (has_direct_input) {
             problem_data.numbers = parse_numbers_string(result["numbers"].as<std::string>());
             problem_data.target_sum = result["target"].as<int>();
-        } else {
-             throw std::runtime_error("No input provided. Use --file or --numbers and --target.");
+        } else if (!batch_mode) {
+             throw std::runtime_error("No input provided. Use --file, --batch or --numbers and --target.");
         }
+        if (result.count("values")) problem_data.values = parse_numbers_string(result["values"].as<std::string>());
         
+        if (result.count("exactly") && result.count("at-most")) throw std::runtime_error("Please provide --exactly OR --at-most, not both.");
+        if (result.count("exactly")) {
+            problem_data.cardinality = CardinalityRule::Exactly;
+            problem_data.cardinality_k = result["exactly"].as<int>();
+        } else if (result.count("at-most")) {
+            problem_data.cardinality = CardinalityRule::AtMost;
+            problem_data.cardinality_k = result["at-most"].as<int>();
+        }
+        if (problem_data.cardinality != CardinalityRule::None && problem_data.cardinality_k < 0) {
+            throw std::runtime_error("Cardinality limit must be non-negative.");
+        }
+
+        if (result.count("convert")) {
+            const std::string out_path = result["convert"].as<std::string>();
+            std::ofstream out(out_path, std::ios::binary);
+            if (!out) throw std::runtime_error("Could not open '" + out_path + "' for writing.");
+            binary_dataset::writeRecord(out, problem_data);
+            std::cout << "Wrote " << problem_data.numbers.size() << " numbers to " << out_path << std::endl;
+            return 0;
+        }
+
         std::string algo_type = result["algo"].as<std::string>();
-        auto solver = SolverFactory::createSolver(algo_type);
+        // Values turn the problem into a knapsack; pick that engine unless one was named.
+        if (!problem_data.values.empty() && !result.count("algo")) algo_type = "knapsack";
+        // Likewise an explicit tolerance asks for the approximation engine.
+        if (result.count("epsilon") && !result.count("algo")) algo_type = "approx";
+        std::unique_ptr<ISubsetSumSolver> solver;
+        if (result["count"].as<bool>()) {
+            algo_type = "count";
+            solver = std::make_unique<CountingSolver>(parse_count_mode(result["count-mode"].as<std::string>()),
+                                                      result["modulus"].as<std::uint64_t>());
+        } else if (algo_type == "approx") {
+            solver = std::make_unique<ApproxSolver>(result["epsilon"].as<double>());
+        } else if ((algo_type == "greedy" || algo_type == "hybrid") && result.count("time-budget-ms")) {
+            const int budget_ms = result["time-budget-ms"].as<int>();
+            if (budget_ms < 0) throw std::runtime_error("Time budget must be non-negative.");
+            const std::chrono::milliseconds budget(budget_ms);
+            if (algo_type == "greedy") solver = std::make_unique<GreedySolver>(budget);
+            else solver = std::make_unique<HybridSolver>(budget);
+        } else {
+            solver = SolverFactory::createSolver(algo_type);
+        }
+        if (result.count("timeout-ms")) {
+            const int timeout_ms = result["timeout-ms"].as<int>();
+            if (timeout_ms <= 0) throw std::runtime_error("Timeout must be positive.");
+            solver->setTimeout(std::chrono::milliseconds(timeout_ms));
+        }
+        if (result["phases"].as<bool>()) solver->setPhaseTiming(true);
+        const bool show_progress = result["progress"].as<bool>();
+        if (show_progress) {
+            const int interval_ms = result["progress-interval-ms"].as<int>();
+            if (interval_ms < 0) throw std::runtime_error("Progress interval must be non-negative.");
+            solver->setProgressCallback(print_progress, std::chrono::milliseconds(interval_ms));
+        }
         bool find_all = result["find-all"].as<bool>();
         bool save_to_db = result["save"].as<bool>();
         
         std::cout << "Using algorithm: " << algo_type << std::endl;
         
-        if (result.count("benchmark")) {
+        if (batch_mode) {
+            // Records are solved straight out of the mapping; nothing is copied.
+            const std::string batch_path = result["batch"].as<std::string>();
+            const MappedFile stream(batch_path);
+            binary_dataset::RecordReader reader(stream.view(), batch_path);
+            DataSetView record;
+            std::size_t solved = 0;
+            double total_ms = 0.0;
+            while (reader.next(record)) {
+                SolverResult record_result = solver->solve(record, find_all);
+                if (record_result.solution_exists) ++solved;
+                total_ms += record_result.execution_time.count();
+                print_batch_line(reader.recordsRead(), record_result);
+            }
+            if (show_progress) std::cerr << std::endl;
+            std::cout << "--- Batch Results ---\n" << "Records: " << reader.recordsRead() << "\n"
+                      << "Records with Solutions: " << solved << " / " << reader.recordsRead() << "\n"
+                      << "Total Solve Time: " << total_ms << " ms\n" << "---------------------" << std::endl;
+        } else if (result.count("benchmark")) {
             if (save_to_db) std::cout << "Note: --save is ignored in benchmark mode." << std::endl;
-            int iterations = result["benchmark"].as<int>();
-            if (iterations <= 0) throw std::runtime_error("Benchmark iterations must be positive.");
-            BenchmarkResult bench_result = BenchmarkRunner::run(*solver, problem_data, iterations, find_all);
+            BenchmarkOptions bench_options;
+            bench_options.iterations = result["benchmark"].as<int>();
+            bench_options.warmup_iterations = result["warmup"].as<int>();
+            bench_options.find_all = find_all;
+            bench_options.perf_counters = result["perf-counters"].as<bool>();
+            if (bench_options.iterations < 0) throw std::runtime_error("Benchmark iterations must be non-negative.");
+            if (bench_options.warmup_iterations < 0) throw std::runtime_error("Warm-up iterations must be non-negative.");
+            if (result.count("min-time-ms")) {
+                bench_options.min_time = std::chrono::duration<double, std::milli>(result["min-time-ms"].as<double>());
+            } else if (bench_options.iterations == 0) {
+                bench_options.min_time = std::chrono::seconds(1);  // auto iteration count
+            }
+            if (bench_options.iterations == 0) bench_options.iterations = 1;
+            // -b N always runs N times; the cap only bounds --min-time-ms top-ups.
+            bench_options.max_iterations = std::max(bench_options.max_iterations, bench_options.iterations);
+            BenchmarkResult bench_result = BenchmarkRunner::run(*solver, problem_data, bench_options);
             print_benchmark_result(bench_result);
+
+            const std::string case_name = result.count("case-name")
+                ? result["case-name"].as<std::string>()
+                : algo_type + " n=" + std::to_string(problem_data.numbers.size()) + " target=" +
+                      std::to_string(problem_data.target_sum) + (find_all ? " find-all" : "");
+            Baseline current{"current", {{case_name, bench_result.samples_ms}}};
+            int regressions = 0;
+            if (result.count("compare-baseline")) {
+                const Baseline reference = baseline::load(result["compare-baseline"].as<std::string>());
+                Baseline matching{reference.name, {}};  // only this case: others were not run
+                if (const BaselineCase* before = reference.find(case_name)) matching.put(*before);
+                const double threshold = result["regression-threshold"].as<double>() / 100.0;
+                regressions = baseline::writeReport(std::cout, reference.name, baseline::compare(matching, current, threshold));
+            }
+            if (result.count("save-baseline")) {
+                const std::string path = result["save-baseline"].as<std::string>();
+                Baseline saved = baseline::loadOrCreate(path, result["baseline-name"].as<std::string>());
+                saved.put(current.cases.front());
+                baseline::save(path, saved);
+                std::cout << "Saved case '" << case_name << "' to baseline " << path << std::endl;
+            }
+            if (result.count("benchmark-json")) {
+                const std::string json_path = result["benchmark-json"].as<std::string>();
+                const std::string json = benchmark_json(algo_type, bench_result).dump(4);
+                if (json_path == "-") {
+                    std::cout << json << std::endl;
+                } else {
+                    std::ofstream out(json_path);
+                    if (!(out << json << std::endl)) throw std::runtime_error("Could not write '" + json_path + "'.");
+                }
+            }
+            if (regressions > 0) return 2;
         } else {
-            SolverResult solver_result = solver->solve(problem_data, find_all);
+            SolverResult solver_result = trackedSolve(*solver, problem_data, find_all, /*measure_rss=*/true);
+            if (show_progress) std::cerr << std::endl;  // finish the progress line
             print_solver_result(solver_result);
 
             if (save_to_db) {
@@ -75,8 +254,24 @@ int main(int argc, char** argv) {
                 j["dataset"]["numbers"] = problem_data.numbers;
                 j["dataset"]["target_sum"] = problem_data.target_sum;
                 j["result"]["solution_found"] = solver_result.solution_exists;
+                j["result"]["status"] = status_name(solver_result.status);
                 j["result"]["execution_time_ms"] = solver_result.execution_time.count();
                 j["result"]["subsets"] = solver_result.subsets;
+                if (!solver_result.solution_count.empty()) j["result"]["solution_count"] = solver_result.solution_count;
+                if (solver_result.achieved_value) j["result"]["achieved_value"] = *solver_result.achieved_value;
+                if (solver_result.achieved_sum) j["result"]["achieved_sum"] = *solver_result.achieved_sum;
+                if (solver_result.optimum_upper_bound) j["result"]["optimum_upper_bound"] = *solver_result.optimum_upper_bound;
+                if (solver_result.memory) {
+                    j["result"]["allocations"] = solver_result.memory->allocations;
+                    j["result"]["allocated_bytes"] = solver_result.memory->allocated_bytes;
+                    j["result"]["peak_heap_bytes"] = solver_result.memory->peak_heap_bytes;
+                }
+                if (solver_result.phases) {
+                    for (std::size_t p = 0; p < kSolvePhaseCount; ++p) {
+                        const SolvePhase phase = static_cast<SolvePhase>(p);
+                        j["result"]["phases_ms"][phaseName(phase)] = (*solver_result.phases)[phase];
+                    }
+                }
 
                 // The Python script is in the root, one level up from the `build` dir
                 std::string command = "python3 ../db_handler.py";
@@ -94,8 +289,203 @@ int main(int argc, char** argv) {
     return 0;
 }
 
-// --- Unchanged Helper Functions ---
-void print_solver_result(const SolverResult& result) { std::cout << "--- Solver Results ---\n" << "Execution Time: " << result.execution_time.count() << " ms\n"; if (result.solution_exists) { std::cout << "Solutions Found: " << result.subsets.size() << "\n"; int count = 1; for (const auto& subset : result.subsets) { std::cout << "  Subset " << count++ << ": { "; for (size_t i = 0; i < subset.size(); ++i) { std::cout << subset[i] << (i == subset.size() - 1 ? "" : ", "); } std::cout << " }\n"; } } else { std::cout << "Solution Found: No\n"; } std::cout << "----------------------\n"; }
-void print_benchmark_result(const BenchmarkResult& result) { std::cout << "--- Benchmark Results ---\n" << "Total Iterations: " << result.iterations << "\n" << "Runs with Solutions: " << result.solutions_found_count << " / " << result.iterations << "\n" << "Total Execution Time: " << result.total_time.count() << " ms\n" << "Average Execution Time: " << result.average_time.count() << " ms\n" << "-------------------------\n"; }
-std::vector<int> parse_numbers_string(const std::string& s) { std::vector<int> numbers; if (s.empty()) return numbers; std::stringstream ss(s); std::string item; while (std::getline(ss, item, ',')) { try { numbers.push_back(std::stoi(item)); } catch (const std::invalid_argument& e) { throw std::runtime_error("'" + item + "' is not a valid integer."); } } return numbers; }
-DataSet parse_from_file(const std::string& filename) { std::ifstream file(filename); if (!file.is_open()) { throw std::runtime_error("Could not open file '" + filename + "'"); } DataSet data; std::string line; if (std::getline(file, line)) { data.numbers = parse_numbers_string(line); } else { throw std::runtime_error("File is empty or could not read numbers line."); } if (std::getline(file, line)) { try { data.target_sum = std::stoi(line); } catch (const std::invalid_argument& e) { throw std::runtime_error("Invalid target sum on the second line."); } } else { throw std::runtime_error("Could not read target sum from file."); } return data; }
+void print_solver_result(const SolverResult& result) {
+    std::cout << "--- Solver Results ---\n" << "Execution Time: " << result.execution_time.count() << " ms\n";
+    if (result.status != SolveStatus::Completed) std::cout << "Status: " << status_name(result.status) << " (partial result)\n";
+    if (!result.solution_count.empty()) {
+        std::cout << "Solution Count: " << result.solution_count;
+        if (result.count_modulus != 0) std::cout << " (mod " << result.count_modulus << ")";
+        std::cout << "\n";
+    }
+    if (result.achieved_sum) std::cout << "Achieved Sum: " << *result.achieved_sum << "\n";
+    if (result.achieved_value) std::cout << "Achieved Value: " << *result.achieved_value << "\n";
+    if (result.optimum_upper_bound) std::cout << "Guaranteed Bound: best possible sum <= " << *result.optimum_upper_bound << "\n";
+    if (result.memory) print_memory_usage(*result.memory, "");
+    if (result.phases) print_phase_times(*result.phases, "");
+    if (result.solution_exists) {
+        if (!result.subsets.empty()) std::cout << "Solutions Found: " << result.subsets.size() << "\n";
+        int count = 1;
+        for (const auto& subset : result.subsets) {
+            std::cout << "  Subset " << count++ << ": { ";
+            for (size_t i = 0; i < subset.size(); ++i) { std::cout << subset[i] << (i == subset.size() - 1 ? "" : ", "); }
+            std::cout << " }\n";
+        }
+    } else {
+        std::cout << "Solution Found: No\n";
+    }
+    std::cout << "----------------------\n";
+}
+void print_benchmark_result(const BenchmarkResult& result) {
+    const BenchmarkStats& stats = result.stats;
+    std::cout << "--- Benchmark Results ---\n" << "Warm-up Iterations: " << result.warmup_iterations << "\n" << "Total Iterations: " << result.iterations << "\n" << "Runs with Solutions: " << result.solutions_found_count << " / " << result.iterations << "\n" << "Total Execution Time: " << result.total_time.count() << " ms\n" << "Average Execution Time: " << result.average_time.count() << " ms\n";
+    if (stats.count > 1) {
+        std::cout << "95% CI of Mean: [" << stats.ci95_low << ", " << stats.ci95_high << "] ms\n"
+                  << "Std Deviation: " << stats.stddev << " ms\n"
+                  << "Min / p50 / p90 / p99 / Max: " << stats.min << " / " << stats.p50 << " / " << stats.p90 << " / "
+                  << stats.p99 << " / " << stats.max << " ms\n"
+                  << "Outliers: " << stats.outliers.total() << " (low severe " << stats.outliers.low_severe << ", low mild "
+                  << stats.outliers.low_mild << ", high mild " << stats.outliers.high_mild << ", high severe "
+                  << stats.outliers.high_severe << ")\n";
+    }
+    if (result.peak_rss_bytes) std::cout << "Peak Memory (RSS): " << *result.peak_rss_bytes / 1024 << " KiB\n";
+    if (result.memory) print_memory_usage(*result.memory, " per Run");
+    if (result.phases) print_phase_times(*result.phases, " per Run");
+    if (!result.perf_error.empty()) std::cout << "Hardware Counters: unavailable (" << result.perf_error << ")\n";
+    if (result.perf && result.iterations > 0) {
+        const PerfCounts& perf = *result.perf;
+        const double runs = result.iterations;
+        auto per_run = [&](const char* label, const std::optional<std::uint64_t>& total) {
+            if (total) std::cout << label << static_cast<double>(*total) / runs << "\n";
+        };
+        per_run("Cycles per Run: ", perf.cycles);
+        per_run("Instructions per Run: ", perf.instructions);
+        if (auto ipc = perf.ipc()) std::cout << "IPC: " << *ipc << "\n";
+        if (auto llc = perf.llcMissesPerMillionCells(result.cells_per_run * runs)) {
+            std::cout << "LLC Misses per Million DP Cells: " << *llc << "\n";
+        }
+        if (auto miss_rate = perf.branchMissRate()) std::cout << "Branch Miss Rate: " << 100.0 * *miss_rate << " %\n";
+        if (!perf.cycles) std::cout << "Hardware Counters: the counter group could not be scheduled\n";
+    }
+    std::cout << "-------------------------\n";
+}
+// Heap figures of a solve (or per benchmark run, per = " per Run").
+void print_memory_usage(const MemoryUsage& memory, const char* per) {
+    std::cout << "Heap Allocations" << per << ": " << memory.allocations << " (" << memory.allocated_bytes / 1024
+              << " KiB)\n" << "Peak Heap" << per << ": " << memory.peak_heap_bytes / 1024 << " KiB\n";
+    if (memory.peak_rss_delta_bytes) std::cout << "Peak RSS Growth: " << *memory.peak_rss_delta_bytes / 1024 << " KiB\n";
+}
+// Time and share of each solve phase (or per benchmark run, per = " per Run").
+void print_phase_times(const PhaseTimes& phases, const char* per) {
+    const double total = phases.total();
+    std::cout << "Phase Times" << per << ":";
+    for (std::size_t p = 0; p < kSolvePhaseCount; ++p) {
+        const SolvePhase phase = static_cast<SolvePhase>(p);
+        std::cout << " " << phaseName(phase) << " " << phases[phase] << " ms";
+        if (total > 0.0) std::cout << " (" << static_cast<int>(100.0 * phases[phase] / total + 0.5) << "%)";
+        std::cout << (p + 1 < kSolvePhaseCount ? "," : "\n");
+    }
+}
+// One line per batch record: its first subset (or the achieved sum) and time.
+void print_batch_line(std::size_t record, const SolverResult& result) {
+    std::cout << "Record " << record << ": ";
+    if (!result.solution_exists) {
+        std::cout << "no solution";
+    } else if (!result.subsets.empty()) {
+        const auto& subset = result.subsets.front();
+        std::cout << "{ ";
+        for (size_t i = 0; i < subset.size(); ++i) std::cout << subset[i] << (i == subset.size() - 1 ? "" : ", ");
+        std::cout << " }";
+        if (result.subsets.size() > 1) std::cout << " (+" << result.subsets.size() - 1 << " more)";
+    } else if (!result.solution_count.empty()) {
+        std::cout << result.solution_count << " solutions";
+    } else {
+        std::cout << "solution found";
+    }
+    if (result.achieved_sum) std::cout << ", sum " << *result.achieved_sum;
+    if (result.achieved_value) std::cout << ", value " << *result.achieved_value;
+    if (result.status != SolveStatus::Completed) std::cout << " [" << status_name(result.status) << "]";
+    std::cout << " (" << result.execution_time.count() << " ms)\n";
+}
+nlohmann::json benchmark_json(const std::string& algo_type, const BenchmarkResult& result) {
+    const BenchmarkStats& stats = result.stats;
+    nlohmann::json j;
+    j["algorithm"] = algo_type;
+    j["warmup_iterations"] = result.warmup_iterations;
+    j["iterations"] = result.iterations;
+    j["solutions_found"] = result.solutions_found_count;
+    j["total_time_ms"] = result.total_time.count();
+    j["stats_ms"] = {{"mean", stats.mean}, {"stddev", stats.stddev}, {"ci95_low", stats.ci95_low},
+                     {"ci95_high", stats.ci95_high}, {"min", stats.min}, {"p50", stats.p50}, {"p90", stats.p90},
+                     {"p99", stats.p99}, {"max", stats.max}};
+    j["outliers"] = {{"low_severe", stats.outliers.low_severe}, {"low_mild", stats.outliers.low_mild},
+                     {"high_mild", stats.outliers.high_mild}, {"high_severe", stats.outliers.high_severe}};
+    if (result.peak_rss_bytes) j["peak_rss_bytes"] = *result.peak_rss_bytes;
+    if (result.memory) {
+        j["memory"]["allocations_per_run"] = result.memory->allocations;
+        j["memory"]["allocated_bytes_per_run"] = result.memory->allocated_bytes;
+        j["memory"]["peak_heap_bytes"] = result.memory->peak_heap_bytes;
+        if (result.memory->peak_rss_delta_bytes) j["memory"]["peak_rss_delta_bytes"] = *result.memory->peak_rss_delta_bytes;
+    }
+    if (result.phases) {
+        for (std::size_t p = 0; p < kSolvePhaseCount; ++p) {
+            const SolvePhase phase = static_cast<SolvePhase>(p);
+            j["phases_ms_per_run"][phaseName(phase)] = (*result.phases)[phase];
+        }
+    }
+    if (!result.perf_error.empty()) j["perf"]["error"] = result.perf_error;
+    if (result.perf) {
+        const PerfCounts& perf = *result.perf;
+        auto put = [&](const char* key, const auto& value) {
+            if (value) j["perf"][key] = *value;
+        };
+        put("cycles", perf.cycles);
+        put("instructions", perf.instructions);
+        put("llc_misses", perf.llc_misses);
+        put("branches", perf.branches);
+        put("branch_misses", perf.branch_misses);
+        put("ipc", perf.ipc());
+        put("llc_misses_per_million_cells", perf.llcMissesPerMillionCells(result.cells_per_run * result.iterations));
+        put("branch_miss_rate", perf.branchMissRate());
+    }
+    j["samples_ms"] = result.samples_ms;
+    return j;
+}
+// --generate: seeded synthetic instances as text or a binary record stream.
+void generate_workload(const cxxopts::ParseResult& options) {
+    WorkloadSpec spec;
+    spec.family = workload::familyFromName(options["generate"].as<std::string>());
+    spec.n = options["size"].as<std::size_t>();
+    spec.scale = options["scale"].as<int>();
+    spec.seed = options["seed"].as<std::uint64_t>();
+    if (options.count("target")) spec.target = options["target"].as<int>();
+    const int records = options["records"].as<int>();
+    const bool binary = options["binary"].as<bool>();
+    if (records < 1) throw std::runtime_error("--records must be positive.");
+    if (records > 1 && !binary) throw std::runtime_error("The text format holds one instance; use --binary for --records.");
+
+    std::ofstream file;
+    if (options.count("output")) {
+        const std::string path = options["output"].as<std::string>();
+        file.open(path, binary ? std::ios::binary : std::ios::out);
+        if (!file) throw std::runtime_error("Could not open '" + path + "' for writing.");
+    } else if (binary) {
+        throw std::runtime_error("Binary output needs --output.");
+    }
+    std::ostream& out = options.count("output") ? file : std::cout;
+    for (int i = 0; i < records; ++i) {
+        const DataSet data = workload::generate(spec);
+        if (binary) binary_dataset::writeRecord(out, data);
+        else dataset_loader::writeText(out, data);
+        ++spec.seed;
+    }
+}
+std::vector<int> parse_numbers_string(const std::string& s) { return number_parser::parseList(s); }
+CountMode parse_count_mode(const std::string& s) {
+    if (s == "u64") return CountMode::Exact64;
+    if (s == "mod") return CountMode::Modular;
+    if (s == "big") return CountMode::BigInt;
+    throw std::runtime_error("Unknown count mode '" + s + "'. Use u64, mod or big.");
+}
+const char* status_name(SolveStatus status) {
+    switch (status) {
+        case SolveStatus::TimedOut: return "timed out";
+        case SolveStatus::Cancelled: return "cancelled";
+        default: return "completed";
+    }
+}
+// Rewrites one status line in place: percentage when the solver knows its
+// total work, otherwise the raw counters.
+void print_progress(const SolveProgress& progress) {
+    std::cerr << "\r[progress] " << static_cast<long long>(progress.elapsed_ms) << " ms";
+    if (progress.steps_total != 0) {
+        std::cerr << " | " << progress.steps_done << "/" << progress.steps_total << " steps ("
+                  << 100 * progress.steps_done / progress.steps_total << "%)";
+    } else if (progress.steps_done != 0) {
+        std::cerr << " | " << progress.steps_done << " steps";
+    }
+    if (progress.nodes != 0) {
+        std::cerr << " | " << progress.nodes << " nodes, " << 100 * progress.pruned / progress.nodes << "% pruned";
+    }
+    if (progress.best_gap) std::cerr << " | best gap " << *progress.best_gap;
+    std::cerr << "   " << std::flush;
+}
@@ -0,0 +1,51 @@
+// tests/SolutionListModelTests.cpp
+// SolutionListModel needs QtCore, so it is tested in its own executable
+// instead of run_tests, which links only solver_lib.
+#include "gtest/gtest.h"
+#include "GUI/SolutionListModel.h"
+#include <vector>
+
+namespace {
+
+// Subset sizes in display order.
+std::vector<int> displayedSizes(const SolutionListModel& model) {
+    std::vector<int> sizes;
+    for (int row = 0; row < model.rowCount(); ++row) {
+        sizes.push_back(model.data(model.index(row), Qt::ToolTipRole).toString().section(' ', 0, 0).toInt());
+    }
+    return sizes;
+}
+
+} // namespace
+
+TEST(SolutionListModelTest, ShowsEveryBatchInDiscoveryOrderWhenUnsorted) {
+    SolutionListModel model;
+    SolutionStore batch;
+    batch.append(std::vector<int>{1, 2, 3});
+    batch.append(std::vector<int>{4});
+    model.appendSolutions(batch);
+    batch.append(std::vector<int>{5, 6});
+    model.appendSolutions(batch);
+
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(displayedSizes(model), (std::vector<int>{3, 1, 2}));
+}
+
+TEST(SolutionListModelTest, KeepsSortOrderAcrossBatches) {
+    SolutionListModel model;
+    model.setOrdering(SolutionListModel::SortKey::Size, Qt::AscendingOrder);
+    SolutionStore batch;
+    batch.append(std::vector<int>{1, 2, 3});
+    batch.append(std::vector<int>{4, 5});
+    model.appendSolutions(batch);
+    ASSERT_EQ(displayedSizes(model), (std::vector<int>{2, 3}));
+
+    // The second batch's subset sorts ahead of everything already shown.
+    batch.append(std::vector<int>{6});
+    batch.append(std::vector<int>{7, 8, 9, 10});
+    model.appendSolutions(batch);
+    EXPECT_EQ(displayedSizes(model), (std::vector<int>{1, 2, 3, 4}));
+
+    model.setOrdering(SolutionListModel::SortKey::Size, Qt::DescendingOrder);
+    EXPECT_EQ(displayedSizes(model), (std::vector<int>{4, 3, 2, 1}));
+}
@@ -1,10 +1,37 @@
 // tests/SolverTests.cpp
 #include "gtest/gtest.h"
 #include "AlgorithmSelector/SolverFactory.h"
+#include "Benchmarking/AllocationTracker.h"
+#include "Benchmarking/Baseline.h"
+#include "Benchmarking/Benchmark.h"
+#include "Benchmarking/ReportWriter.h"
+#include "Benchmarking/ScalingSweep.h"
+#include "Benchmarking/ThroughputBenchmark.h"
+#include "CoreSolver/SparseDpSolver.h"
+#include "CoreSolver/CountingSolver.h"
+#include "CoreSolver/ApproxSolver.h"
+#include "CoreSolver/GreedySolver.h"
+#include "CoreSolver/HybridSolver.h"
+#include "CoreSolver/KnapsackSolver.h"
 #include "DataModel/DataSet.h"
+#include "DataModel/SolutionStore.h"
+#include "Parsing/NumberParser.h"
+#include "IO/BinaryDataSet.h"
+#include "IO/DataSetLoader.h"
+#include "IO/MappedFile.h"
+#include "Workload/WorkloadGenerator.h"
 #include <vector>
 #include <numeric>
 #include <algorithm>
+#include <random>
+#include <memory>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+#include <climits>
 
 // Fixture for common test data
 class SolverTest : public ::testing::Test {
@@ -39,6 +66,56 @@ TEST_F(SolverTest, DPSolver_NoSolution) {
     ASSERT_FALSE(result.solution_exists);
 }
 
+TEST_F(SolverTest, DPSolver_FindAllMatchesBacktracking) {
+    data.numbers = {3, 34, 4, 12, 5, 2, 7, 4, 1};
+    auto dp = SolverFactory::createSolver("dp");
+    auto backtrack = SolverFactory::createSolver("backtrack");
+    for (int target = 0; target <= 40; ++target) {
+        data.target_sum = target;
+        auto expected = backtrack->solve(data, true);
+        auto result = dp->solve(data, true);
+        ASSERT_EQ(result.solution_exists, expected.solution_exists) << "target " << target;
+
+        // Both enumerate subsets by position; compare them order-independently.
+        auto actual = result.subsets;
+        auto wanted = expected.subsets;
+        for (auto& subset : actual) std::sort(subset.begin(), subset.end());
+        for (auto& subset : wanted) std::sort(subset.begin(), subset.end());
+        std::sort(actual.begin(), actual.end());
+        std::sort(wanted.begin(), wanted.end());
+        ASSERT_EQ(actual, wanted) << "target " << target;
+    }
+}
+
+TEST_F(SolverTest, DPSolver_CardinalityMatchesBacktracking) {
+    data.numbers = {3, 34, 4, 12, 5, 2, 7, 4, 1, 6};
+    auto dp = SolverFactory::createSolver("dp");
+    auto backtrack = SolverFactory::createSolver("backtrack");
+    for (CardinalityRule rule : {CardinalityRule::Exactly, CardinalityRule::AtMost}) {
+        for (int k = 0; k <= 5; ++k) {
+            data.cardinality = rule;
+            data.cardinality_k = k;
+            for (int target = 0; target <= 30; ++target) {
+                data.target_sum = target;
+                auto expected = backtrack->solve(data, true);
+                auto all = dp->solve(data, true);
+                auto one = dp->solve(data);
+                ASSERT_EQ(all.subsets.size(), expected.subsets.size()) << "k " << k << " target " << target;
+                ASSERT_EQ(one.solution_exists, expected.solution_exists);
+                for (const auto& subset : expected.subsets) {
+                    verify_subset_sum(target, subset);
+                    if (rule == CardinalityRule::Exactly) ASSERT_EQ(subset.size(), static_cast<size_t>(k));
+                    else ASSERT_LE(subset.size(), static_cast<size_t>(k));
+                }
+                if (one.solution_exists) {
+                    verify_subset_sum(target, one.subsets[0]);
+                    ASSERT_LE(one.subsets[0].size(), static_cast<size_t>(k));
+                }
+            }
+        }
+    }
+}
+
 // --- Test the Backtracking Solver ---
 TEST_F(SolverTest, BacktrackingSolver_FindsSolution) {
     data.target_sum = 9;
@@ -77,3 +154,972 @@ TEST_F(SolverTest, EdgeCase_TargetIsZero) {
     ASSERT_EQ(result.subsets.size(), 1);
     ASSERT_TRUE(result.subsets[0].empty());
 }
+
+// --- Test the Sparse DP Solver ---
+TEST_F(SolverTest, SparseSolver_FindsSolution) {
+    data.target_sum = 9;
+    auto solver = SolverFactory::createSolver("sparse");
+    auto result = solver->solve(data);
+
+    ASSERT_TRUE(result.solution_exists);
+    ASSERT_EQ(result.subsets.size(), 1);
+    verify_subset_sum(data.target_sum, result.subsets[0]);
+}
+
+TEST_F(SolverTest, SparseSolver_NoSolution) {
+    data.target_sum = 30;
+    auto solver = SolverFactory::createSolver("sparse");
+    auto result = solver->solve(data);
+    ASSERT_FALSE(result.solution_exists);
+}
+
+TEST_F(SolverTest, SparseSolver_HugeTargetFewItems) {
+    data.numbers = {1000000007, 300000000, 700000001, 999999999, 123456789};
+    data.target_sum = 1000000007 + 123456789 + 700000001;
+    auto solver = SolverFactory::createSolver("sparse");
+    auto result = solver->solve(data);
+
+    ASSERT_TRUE(result.solution_exists);
+    verify_subset_sum(data.target_sum, result.subsets[0]);
+}
+
+TEST_F(SolverTest, SparseSolver_DenseSwitchMatchesDp) {
+    // A zero threshold forces the bitset path right after the first item.
+    SparseDpSolver sparse(0.0);
+    auto dp = SolverFactory::createSolver("dp");
+    for (int target = 0; target <= 60; ++target) {
+        data.target_sum = target;
+        auto expected = dp->solve(data);
+        auto result = sparse.solve(data);
+        ASSERT_EQ(result.solution_exists, expected.solution_exists) << "target " << target;
+        if (result.solution_exists) verify_subset_sum(target, result.subsets[0]);
+    }
+}
+
+// --- Test the Counting Solver ---
+TEST_F(SolverTest, CountingSolver_MatchesBacktrackingEnumeration) {
+    data.numbers = {1, 2, 3, 4, 5, 6, 3, 2};
+    auto counter = SolverFactory::createSolver("count");
+    auto backtrack = SolverFactory::createSolver("backtrack");
+    for (int target = 0; target <= 26; ++target) {
+        data.target_sum = target;
+        auto all = backtrack->solve(data, true);
+        auto counted = counter->solve(data);
+        ASSERT_EQ(counted.solution_count, std::to_string(all.subsets.size())) << "target " << target;
+        ASSERT_EQ(counted.solution_exists, all.solution_exists);
+        ASSERT_TRUE(counted.subsets.empty());
+    }
+}
+
+TEST_F(SolverTest, CountingSolver_BigIntBeyond64Bits) {
+    // C(100, 50) = 100891344545564193334812497256
+    data.numbers.assign(100, 1);
+    data.target_sum = 50;
+    CountingSolver big(CountMode::BigInt);
+    EXPECT_EQ(big.solve(data).solution_count, "100891344545564193334812497256");
+
+    CountingSolver exact(CountMode::Exact64);
+    EXPECT_THROW(exact.solve(data), std::overflow_error);
+}
+
+TEST_F(SolverTest, CountingSolver_BigIntZeroWeightsCrossLimbs) {
+    // Every subset of n zeros sums to 0: 2^n of them.
+    data.target_sum = 0;
+    CountingSolver big(CountMode::BigInt);
+    data.numbers.assign(63, 0);
+    EXPECT_EQ(big.solve(data).solution_count, "9223372036854775808");
+    data.numbers.assign(64, 0);
+    auto result = big.solve(data);
+    EXPECT_EQ(result.solution_count, "18446744073709551616");
+    EXPECT_TRUE(result.solution_exists);
+    data.numbers.assign(70, 0);
+    EXPECT_EQ(big.solve(data).solution_count, "1180591620717411303424");
+    data.numbers = {0, 0, 3, 0, 4};
+    data.target_sum = 7;
+    EXPECT_EQ(big.solve(data).solution_count, "8");
+}
+
+TEST_F(SolverTest, CountingSolver_Modular) {
+    data.numbers.assign(100, 1);
+    data.target_sum = 50;
+    CountingSolver modular(CountMode::Modular, 1000000007ULL);
+    auto result = modular.solve(data);
+    EXPECT_EQ(result.solution_count, "538992043");
+    EXPECT_EQ(result.count_modulus, 1000000007ULL);
+    EXPECT_TRUE(result.solution_exists);
+}
+
+// --- Test the Knapsack Solvers ---
+TEST_F(SolverTest, KnapsackSolvers_MatchBruteForce) {
+    std::mt19937 rng(42);
+    for (int round = 0; round < 200; ++round) {
+        const int n = static_cast<int>(rng() % 13);
+        data.numbers.clear();
+        data.values.clear();
+        for (int i = 0; i < n; ++i) {
+            data.numbers.push_back(static_cast<int>(rng() % 40));
+            data.values.push_back(static_cast<int>(rng() % 60));
+        }
+        data.target_sum = static_cast<int>(rng() % 120);
+
+        long long optimum = 0;
+        for (int mask = 0; mask < (1 << n); ++mask) {
+            long long weight = 0, value = 0;
+            for (int i = 0; i < n; ++i) {
+                if (mask & (1 << i)) { weight += data.numbers[i]; value += data.values[i]; }
+            }
+            if (weight <= data.target_sum) optimum = std::max(optimum, value);
+        }
+
+        for (const char* type : {"knapsack", "knapsack-dp", "knapsack-bnb", "knapsack-core"}) {
+            auto result = SolverFactory::createSolver(type)->solve(data);
+            ASSERT_TRUE(result.solution_exists) << type;
+            ASSERT_EQ(*result.achieved_value, optimum) << type << " round " << round;
+            const auto& subset = result.subsets[0];
+            ASSERT_EQ(std::accumulate(subset.begin(), subset.end(), 0LL), *result.achieved_sum) << type;
+            ASSERT_LE(*result.achieved_sum, data.target_sum) << type;
+        }
+    }
+}
+
+TEST_F(SolverTest, KnapsackSolvers_RejectMissingValues) {
+    data.target_sum = 9;
+    EXPECT_THROW(SolverFactory::createSolver("knapsack-dp")->solve(data), std::invalid_argument);
+    data.values = {1, 1, 1, 1, 1, 1};
+    EXPECT_THROW(SolverFactory::createSolver("knapsack-bnb")->solve(data, true), std::logic_error);
+}
+
+TEST_F(SolverTest, KnapsackSolver_BoundsDenseTableBytes) {
+    // One item and a budget near 60M: few cells, but a 480 MB best row.
+    ASSERT_GT(KnapsackDpSolver::tableBytes(1, 60000000), KnapsackSolver::kMaxDpBytes);
+    ASSERT_LE(KnapsackDpSolver::tableBytes(1000, 100000), KnapsackSolver::kMaxDpBytes);
+    data.numbers = {7};
+    data.values = {3};
+    data.target_sum = 60000000;
+    KnapsackSolver solver;
+    const SolverResult result = trackedSolve(solver, data, false);
+    ASSERT_EQ(result.subsets, (std::vector<std::vector<int>>{{7}}));
+    ASSERT_LT(result.memory->allocated_bytes, KnapsackSolver::kMaxDpBytes);
+}
+
+TEST_F(SolverTest, KnapsackCoreSolver_LargeInstanceMatchesDp) {
+    std::mt19937 rng(7);
+    data.numbers.clear();
+    data.values.clear();
+    for (int i = 0; i < 2000; ++i) {
+        const int weight = 100 + static_cast<int>(rng() % 900);
+        data.numbers.push_back(weight);
+        data.values.push_back(weight + static_cast<int>(rng() % 100));
+    }
+    data.target_sum = 50000;
+    auto dp = SolverFactory::createSolver("knapsack-dp")->solve(data);
+    auto core = SolverFactory::createSolver("knapsack-core")->solve(data);
+    EXPECT_EQ(*core.achieved_value, *dp.achieved_value);
+}
+
+// --- Test the Approximate Solver ---
+TEST_F(SolverTest, ApproxSolver_WithinGuarantee) {
+    std::mt19937 rng(11);
+    for (double epsilon : {0.5, 0.1, 0.01}) {
+        ApproxSolver solver(epsilon);
+        for (int round = 0; round < 100; ++round) {
+            const int n = 1 + static_cast<int>(rng() % 12);
+            data.numbers.clear();
+            for (int i = 0; i < n; ++i) data.numbers.push_back(1 + static_cast<int>(rng() % 1000));
+            data.target_sum = static_cast<int>(rng() % 4000);
+
+            long long optimum = 0;
+            for (int mask = 0; mask < (1 << n); ++mask) {
+                long long sum = 0;
+                for (int i = 0; i < n; ++i) if (mask & (1 << i)) sum += data.numbers[i];
+                if (sum <= data.target_sum) optimum = std::max(optimum, sum);
+            }
+
+            auto result = solver.solve(data);
+            ASSERT_TRUE(result.solution_exists);
+            const auto& subset = result.subsets[0];
+            ASSERT_EQ(std::accumulate(subset.begin(), subset.end(), 0LL), *result.achieved_sum);
+            ASSERT_LE(*result.achieved_sum, data.target_sum);
+            ASSERT_GE(static_cast<double>(*result.achieved_sum), (1.0 - epsilon) * optimum);
+            ASSERT_GE(*result.optimum_upper_bound, optimum);
+        }
+    }
+}
+
+TEST_F(SolverTest, ApproxSolver_RejectsBadEpsilon) {
+    EXPECT_THROW(ApproxSolver(0.0), std::invalid_argument);
+    EXPECT_THROW(ApproxSolver(1.0), std::invalid_argument);
+}
+
+// --- Test the Greedy and Hybrid Solvers ---
+TEST_F(SolverTest, GreedySolver_FeasibleAndNearTarget) {
+    data.target_sum = 30;
+    GreedySolver solver(std::chrono::milliseconds(5));
+    auto result = solver.solve(data);
+    ASSERT_TRUE(result.solution_exists);
+    ASSERT_EQ(std::accumulate(result.subsets[0].begin(), result.subsets[0].end(), 0LL), *result.achieved_sum);
+    ASSERT_LE(*result.achieved_sum, data.target_sum);
+    // 3 + 4 + 12 + 5 + 2 = 26 is the best sum within 30.
+    ASSERT_EQ(*result.achieved_sum, 26);
+}
+
+TEST_F(SolverTest, HybridSolver_ProvesOptimum) {
+    std::mt19937 rng(5);
+    HybridSolver solver(std::chrono::milliseconds(1000));
+    for (int round = 0; round < 100; ++round) {
+        const int n = 1 + static_cast<int>(rng() % 14);
+        data.numbers.clear();
+        for (int i = 0; i < n; ++i) data.numbers.push_back(2 * (1 + static_cast<int>(rng() % 500)));
+        data.target_sum = 1 + 2 * static_cast<int>(rng() % 2000);  // odd: never hit exactly
+
+        long long optimum = 0;
+        for (int mask = 0; mask < (1 << n); ++mask) {
+            long long sum = 0;
+            for (int i = 0; i < n; ++i) if (mask & (1 << i)) sum += data.numbers[i];
+            if (sum <= data.target_sum) optimum = std::max(optimum, sum);
+        }
+
+        auto result = solver.solve(data);
+        ASSERT_TRUE(result.solution_exists);
+        ASSERT_EQ(*result.achieved_sum, optimum);
+        ASSERT_EQ(std::accumulate(result.subsets[0].begin(), result.subsets[0].end(), 0LL), optimum);
+        ASSERT_TRUE(result.optimum_upper_bound.has_value());
+        ASSERT_EQ(*result.optimum_upper_bound, optimum);
+    }
+}
+
+TEST_F(SolverTest, Timeout_StopsHardBacktrackingSearch) {
+    // Even numbers and an odd target: no pruning can rule the search out early.
+    data.numbers.clear();
+    for (int i = 0; i < 60; ++i) data.numbers.push_back(2 * (1000 + 37 * i));
+    data.target_sum = 30001;
+    auto solver = SolverFactory::createSolver("backtrack");
+    solver->setTimeout(std::chrono::milliseconds(20));
+
+    auto result = solver->solve(data);
+    ASSERT_EQ(result.status, SolveStatus::TimedOut);
+    ASSERT_FALSE(result.solution_exists);
+    ASSERT_LT(result.execution_time.count(), 1000.0);
+    // The closest sum found before the deadline comes back as a partial answer.
+    ASSERT_TRUE(result.achieved_sum.has_value());
+    ASSERT_GT(*result.achieved_sum, 0);
+    ASSERT_LT(*result.achieved_sum, data.target_sum);
+    ASSERT_EQ(result.subsets.size(), 1u);
+    ASSERT_EQ(std::accumulate(result.subsets[0].begin(), result.subsets[0].end(), 0LL), *result.achieved_sum);
+}
+
+TEST_F(SolverTest, Cancellation_BacktrackingReportsClosestSumSoFar) {
+    data.numbers = {3, 34, 4, 12, 5, 2};
+    data.target_sum = 9;
+    data.cardinality = CardinalityRule::Exactly;
+    data.cardinality_k = 2;
+    auto token = std::make_shared<CancellationToken>();
+    auto solver = SolverFactory::createSolver("backtrack");
+    solver->setCancellationToken(token);
+    token->cancel();
+    auto result = solver->solve(data);
+    ASSERT_EQ(result.status, SolveStatus::Cancelled);
+    // Nothing admissible was visited before the stop: no partial answer.
+    ASSERT_FALSE(result.achieved_sum.has_value());
+    ASSERT_TRUE(result.subsets.empty());
+
+    data.cardinality = CardinalityRule::None;
+    result = solver->solve(data);
+    ASSERT_EQ(result.status, SolveStatus::Cancelled);
+    ASSERT_EQ(result.achieved_sum, 0);
+    ASSERT_EQ(result.subsets, (std::vector<std::vector<int>>{{}}));
+}
+
+TEST_F(SolverTest, Cancellation_PreCancelledTokenStopsEverySolver) {
+    data.numbers.clear();
+    for (int i = 0; i < 200; ++i) data.numbers.push_back(2 * (100 + 7 * i));
+    data.target_sum = 20001;
+    auto token = std::make_shared<CancellationToken>();
+    token->cancel();
+    for (const std::string name : {"dp", "backtrack", "sparse", "count", "approx", "greedy", "hybrid"}) {
+        auto solver = SolverFactory::createSolver(name);
+        solver->setCancellationToken(token);
+        auto result = solver->solve(data);
+        ASSERT_EQ(result.status, SolveStatus::Cancelled) << name;
+    }
+}
+
+TEST_F(SolverTest, Cancellation_DpReportsClosestSumSoFar) {
+    data.numbers = {3, 34, 4, 12, 5, 2};
+    data.target_sum = 9;
+    auto solver = SolverFactory::createSolver("dp");
+    // Without a stop the same solver runs to completion.
+    auto result = solver->solve(data);
+    ASSERT_EQ(result.status, SolveStatus::Completed);
+    ASSERT_TRUE(result.solution_exists);
+
+    auto token = std::make_shared<CancellationToken>();
+    solver->setCancellationToken(token);
+    token->cancel();
+    result = solver->solve(data);
+    ASSERT_EQ(result.status, SolveStatus::Cancelled);
+    ASSERT_TRUE(result.achieved_sum.has_value());
+    ASSERT_LE(*result.achieved_sum, data.target_sum);
+}
+
+TEST_F(SolverTest, Progress_DpReportsRowsDone) {
+    // Even numbers, odd target: every row is filled, one clock check per row.
+    data.numbers.clear();
+    for (int i = 0; i < 50; ++i) data.numbers.push_back(2 * (1 + i));
+    data.target_sum = (1 << 20) + 1;
+    std::vector<SolveProgress> reports;
+    auto solver = SolverFactory::createSolver("dp");
+    solver->setProgressCallback([&](const SolveProgress& p) { reports.push_back(p); }, std::chrono::milliseconds(0));
+
+    auto result = solver->solve(data);
+    ASSERT_FALSE(result.solution_exists);
+    ASSERT_FALSE(reports.empty());
+    for (size_t i = 0; i < reports.size(); ++i) {
+        ASSERT_EQ(reports[i].steps_total, 50u);
+        ASSERT_LE(reports[i].steps_done, 50u);
+        if (i > 0) {
+            ASSERT_GE(reports[i].steps_done, reports[i - 1].steps_done);
+        }
+    }
+}
+
+TEST_F(SolverTest, Progress_BacktrackingReportsNodesAndGap) {
+    data.numbers.clear();
+    for (int i = 0; i < 22; ++i) data.numbers.push_back(2 * (50 + 3 * i));
+    data.target_sum = 1001;
+    std::vector<SolveProgress> reports;
+    auto solver = SolverFactory::createSolver("backtrack");
+    solver->setProgressCallback([&](const SolveProgress& p) { reports.push_back(p); }, std::chrono::milliseconds(0));
+
+    solver->solve(data);
+    ASSERT_FALSE(reports.empty());
+    for (size_t i = 0; i < reports.size(); ++i) {
+        ASSERT_LE(reports[i].pruned, reports[i].nodes);
+        ASSERT_TRUE(reports[i].best_gap.has_value());
+        ASSERT_GE(*reports[i].best_gap, 1);  // the odd target is never hit
+        if (i > 0) {
+            ASSERT_GT(reports[i].nodes, reports[i - 1].nodes);
+            ASSERT_LE(*reports[i].best_gap, *reports[i - 1].best_gap);
+            ASSERT_GE(reports[i].elapsed_ms, reports[i - 1].elapsed_ms);
+        }
+    }
+}
+
+TEST_F(SolverTest, SolutionCallback_StreamsEveryEnumeratedSubset) {
+    data.numbers = {1, 2, 3, 4, 5, 6};
+    data.target_sum = 6;
+    for (const std::string name : {"dp", "backtrack"}) {
+        std::vector<std::vector<int>> streamed;
+        auto solver = SolverFactory::createSolver(name);
+        solver->setSolutionCallback([&](const std::vector<int>& subset) { streamed.push_back(subset); });
+        auto result = solver->solve(data, true);
+        ASSERT_EQ(result.subsets.size(), 4u) << name;
+        ASSERT_EQ(streamed, result.subsets) << name;
+    }
+}
+
+TEST_F(SolverTest, SolutionCallback_StreamOnlyLeavesResultEmpty) {
+    data.numbers = {1, 2, 3, 4, 5, 6};
+    data.target_sum = 6;
+    SolutionStore store;
+    auto solver = SolverFactory::createSolver("dp");
+    solver->setSolutionCallback([&](const std::vector<int>& subset) { store.append(subset); }, false);
+    auto result = solver->solve(data, true);
+    ASSERT_TRUE(result.solution_exists);
+    ASSERT_TRUE(result.subsets.empty());
+    ASSERT_EQ(store.size(), 4u);
+    for (size_t i = 0; i < store.size(); ++i) {
+        const auto subset = store.toVector(i);
+        ASSERT_EQ(std::accumulate(subset.begin(), subset.end(), 0), 6);
+    }
+}
+
+TEST(SolutionStoreTest, RoundTripsSubsets) {
+    const std::vector<std::vector<int>> subsets = {{1, 2, 3}, {}, {42}, {7, 7}};
+    SolutionStore store, batch;
+    for (const auto& subset : subsets) batch.append(subset);
+    store.append(batch);
+    ASSERT_EQ(store.size(), subsets.size());
+    for (size_t i = 0; i < subsets.size(); ++i) {
+        ASSERT_EQ(store.toVector(i), subsets[i]);
+        ASSERT_EQ(store[i].size(), subsets[i].size());
+    }
+    store.clear();
+    ASSERT_TRUE(store.empty());
+}
+
+TEST_F(SolverTest, SolverFactory_CreatesEveryRegisteredType) {
+    const auto types = SolverFactory::registeredTypes();
+    ASSERT_FALSE(types.empty());
+    for (const auto& type : types) {
+        ASSERT_NE(SolverFactory::createSolver(type), nullptr) << type;
+    }
+    ASSERT_THROW(SolverFactory::createSolver("no-such-engine"), std::invalid_argument);
+}
+
+TEST_F(SolverTest, Benchmark_RecordsEverySample) {
+    auto solver = SolverFactory::createSolver("dp");
+    int callbacks = 0;
+    auto bench = BenchmarkRunner::run(*solver, data, 7, false, [&](int iteration, const SolverResult& result) {
+        ASSERT_EQ(iteration, callbacks);
+        ASSERT_TRUE(result.solution_exists);
+        ++callbacks;
+    });
+    ASSERT_EQ(callbacks, 7);
+    ASSERT_EQ(bench.iterations, 7);
+    ASSERT_EQ(bench.samples_ms.size(), 7u);
+    ASSERT_EQ(bench.solutions_found_count, 7);
+}
+
+TEST_F(SolverTest, Benchmark_WarmsUpAndRunsForMinimumTime) {
+    data.target_sum = 9;
+    auto solver = SolverFactory::createSolver("dp");
+    BenchmarkOptions options;
+    options.iterations = 3;
+    options.warmup_iterations = 2;
+    options.min_time = std::chrono::milliseconds(5);
+    auto bench = BenchmarkRunner::run(*solver, data, options);
+    ASSERT_EQ(bench.warmup_iterations, 2);
+    ASSERT_GE(bench.iterations, 3);
+    ASSERT_GE(bench.total_time.count(), 5.0);
+    ASSERT_EQ(bench.stats.count, bench.samples_ms.size());
+    ASSERT_LE(bench.stats.min, bench.stats.p50);
+    ASSERT_LE(bench.stats.p99, bench.stats.max);
+}
+
+TEST(BenchmarkStatsTest, SummarizesPercentilesAndOutliers) {
+    std::vector<double> samples;
+    for (int i = 1; i <= 20; ++i) samples.push_back(10.0 + i % 5);  // 10..14
+    samples.push_back(100.0);                                       // far above the fences
+    samples.push_back(1.0);                                         // just below
+    const BenchmarkStats stats = benchmark_stats::summarize(samples);
+    ASSERT_EQ(stats.count, 22u);
+    ASSERT_DOUBLE_EQ(stats.min, 1.0);
+    ASSERT_DOUBLE_EQ(stats.max, 100.0);
+    ASSERT_DOUBLE_EQ(stats.p50, 12.0);
+    ASSERT_EQ(stats.outliers.high_severe, 1u);
+    ASSERT_EQ(stats.outliers.low_mild + stats.outliers.low_severe, 1u);
+    ASSERT_EQ(stats.outliers.total(), 2u);
+    ASSERT_LT(stats.ci95_low, stats.mean);
+    ASSERT_GT(stats.ci95_high, stats.mean);
+
+    // Constant samples: no spread, no outliers, a degenerate interval.
+    const BenchmarkStats flat = benchmark_stats::summarize({2.0, 2.0, 2.0});
+    ASSERT_DOUBLE_EQ(flat.stddev, 0.0);
+    ASSERT_DOUBLE_EQ(flat.ci95_low, 2.0);
+    ASSERT_EQ(flat.outliers.total(), 0u);
+    ASSERT_EQ(benchmark_stats::summarize({}).count, 0u);
+}
+
+TEST_F(SolverTest, Benchmark_PerfCountersDegradeGracefully) {
+    data.target_sum = 9;
+    auto solver = SolverFactory::createSolver("dp");
+    BenchmarkOptions options;
+    options.iterations = 5;
+    options.perf_counters = true;
+    auto bench = BenchmarkRunner::run(*solver, data, options);
+    ASSERT_EQ(bench.iterations, 5);
+    ASSERT_DOUBLE_EQ(bench.cells_per_run, 6.0 * 10.0);
+    // Either counts or a reason, never neither (VMs often expose no PMU).
+    ASSERT_NE(bench.perf.has_value(), !bench.perf_error.empty());
+
+    PerfCounts totals;
+    PerfCounts run;
+    run.cycles = 1000;
+    run.instructions = 2500;
+    run.branches = 200;
+    run.branch_misses = 10;
+    totals += run;
+    totals += run;
+    ASSERT_EQ(*totals.cycles, 2000u);
+    ASSERT_DOUBLE_EQ(*totals.ipc(), 2.5);
+    ASSERT_DOUBLE_EQ(*totals.branchMissRate(), 0.05);
+    ASSERT_FALSE(totals.llcMissesPerMillionCells(1e6).has_value());
+}
+
+TEST(AllocationTrackerTest, CountsAllocationsAndNestedPeaks) {
+    AllocationScope outer;
+    {
+        AllocationScope inner;
+        auto block = std::make_unique<char[]>(1 << 20);
+        block[0] = 1;
+        const MemoryUsage usage = inner.usage();
+        ASSERT_EQ(usage.allocations, 1u);
+        ASSERT_GE(usage.allocated_bytes, 1u << 20);
+        ASSERT_GE(usage.peak_heap_bytes, 1u << 20);
+    }
+    // Freed by now, but the enclosing scope still saw the peak.
+    const MemoryUsage usage = outer.usage();
+    ASSERT_EQ(usage.allocations, 1u);
+    ASSERT_GE(usage.peak_heap_bytes, 1u << 20);
+}
+
+TEST_F(SolverTest, AllocationTracker_DpTableMatchesItsSize) {
+    // The reachability table holds (n + 1) x (target + 1) bits; a layout
+    // regression (bytes per cell, a second table) shows up as a larger peak.
+    data.numbers.assign(50, 997);
+    data.target_sum = 10000;  // unreachable: the whole table gets built
+    auto solver = SolverFactory::createSolver("dp");
+    const SolverResult result = trackedSolve(*solver, data, false);
+    ASSERT_FALSE(result.solution_exists);
+    ASSERT_TRUE(result.memory.has_value());
+    const double table_bytes = 51.0 * 10001.0 / 8.0;
+    ASSERT_GE(static_cast<double>(result.memory->peak_heap_bytes), table_bytes);
+    ASSERT_LE(static_cast<double>(result.memory->peak_heap_bytes), 1.5 * table_bytes + 4096.0);
+    ASSERT_LE(result.memory->allocations, 10u);
+
+    // The table stays in the solver's workspace, so later runs reuse it.
+    ASSERT_GE(static_cast<double>(solver->workspaceBytes()), table_bytes);
+    auto bench = BenchmarkRunner::run(*solver, data, 3, false);
+    ASSERT_TRUE(bench.memory.has_value());
+    ASSERT_EQ(bench.memory->peak_heap_bytes, 0u);
+    ASSERT_EQ(bench.memory->allocations, 0u);
+}
+
+TEST_F(SolverTest, Workspace_SteadyStateSolvesDoNotAllocate) {
+    data.target_sum = 9;
+    for (const std::string type : {"dp", "sparse", "backtrack"}) {
+        for (const bool find_all : {false, true}) {
+            if (type == "sparse" && find_all) continue;
+            auto solver = SolverFactory::createSolver(type);
+            std::size_t streamed = 0;
+            solver->setSolutionCallback([&](const std::vector<int>&) { ++streamed; }, /*retain_in_result=*/false);
+            trackedSolve(*solver, data, find_all);  // grows the workspace
+            const std::size_t grown = solver->workspaceBytes();
+
+            const SolverResult result = trackedSolve(*solver, data, find_all);
+            ASSERT_TRUE(result.solution_exists) << type;
+            // sparse does not stream, so its one subset is always returned.
+            const std::uint64_t expected = type == "sparse" ? 2u : 0u;
+            ASSERT_EQ(result.memory->allocations, expected) << type << " find_all=" << find_all;
+            ASSERT_EQ(solver->workspaceBytes(), grown) << type;
+            if (type != "sparse") {
+                ASSERT_GT(streamed, 0u) << type;
+            }
+        }
+    }
+
+    // Retained results allocate only the returned subsets: the outer vector
+    // plus one per subset.
+    auto dp = SolverFactory::createSolver("dp");
+    dp->solve(data, true);
+    const SolverResult all = trackedSolve(*dp, data, true);
+    ASSERT_EQ(all.subsets.size(), 2u);  // {4, 5} and {3, 4, 2}
+    ASSERT_LE(all.memory->allocations, 1u + 2u + 1u);  // the outer vector may grow once
+
+    // A smaller instance reuses the grown workspace; release gives it back.
+    data.target_sum = 5;
+    ASSERT_EQ(trackedSolve(*dp, data, false).memory->allocations, 2u);
+    dp->releaseWorkspace();
+    ASSERT_EQ(dp->workspaceBytes(), 0u);
+    ASSERT_TRUE(dp->solve(data).solution_exists);
+}
+
+TEST_F(SolverTest, PhaseTiming_OnlyWhenEnabled) {
+    data.target_sum = 9;
+    for (const std::string type : {"dp", "sparse", "knapsack-dp"}) {
+        auto solver = SolverFactory::createSolver(type);
+        data.values = type == "knapsack-dp" ? data.numbers : std::vector<int>{};
+        ASSERT_FALSE(solver->solve(data).phases.has_value()) << type;
+
+        solver->setPhaseTiming(true);
+        const SolverResult result = solver->solve(data);
+        ASSERT_TRUE(result.solution_exists) << type;
+        ASSERT_TRUE(result.phases.has_value()) << type;
+        for (const double ms : result.phases->ms) ASSERT_GE(ms, 0.0) << type;
+        ASSERT_GT((*result.phases)[SolvePhase::Fill], 0.0) << type;
+        ASSERT_LE(result.phases->total(), result.execution_time.count()) << type;
+
+        auto bench = BenchmarkRunner::run(*solver, data, 4, false);
+        ASSERT_TRUE(bench.phases.has_value()) << type;
+        ASSERT_LE(bench.phases->total(), bench.stats.max) << type;
+    }
+    // Engines without phase timers leave the breakdown empty.
+    auto backtrack = SolverFactory::createSolver("backtrack");
+    backtrack->setPhaseTiming(true);
+    ASSERT_FALSE(backtrack->solve(data).phases.has_value());
+}
+
+TEST(NumberParserTest, ParsesListsWithWhitespace) {
+    ASSERT_EQ(number_parser::parseList("3, 34,4 ,\n12,+5,-2"), (std::vector<int>{3, 34, 4, 12, 5, -2}));
+    ASSERT_EQ(number_parser::parseList("1,2,"), (std::vector<int>{1, 2}));
+    ASSERT_TRUE(number_parser::parseList("  ").empty());
+    ASSERT_EQ(number_parser::parseList("7;8", ';'), (std::vector<int>{7, 8}));
+    ASSERT_EQ(number_parser::parseInteger(" 42\r\n"), 42);
+}
+
+TEST(NumberParserTest, ReportsErrorPositions) {
+    auto offsetOf = [](const std::string& text) -> std::size_t {
+        try {
+            number_parser::parseList(text);
+        } catch (const ParseError& e) {
+            return e.offset();
+        }
+        return std::string::npos;
+    };
+    ASSERT_EQ(offsetOf("1,2,abc,4"), 4u);
+    ASSERT_EQ(offsetOf("1,2x"), 2u);
+    ASSERT_EQ(offsetOf("1,,2"), 2u);
+    ASSERT_EQ(offsetOf("1 2"), 2u);
+    ASSERT_EQ(offsetOf("1,99999999999"), 2u);
+    ASSERT_EQ(offsetOf("1,+-3"), 2u);
+    try {
+        number_parser::parseList("1,2,\n3,x");
+        FAIL() << "expected a ParseError";
+    } catch (const ParseError& e) {
+        ASSERT_NE(std::string(e.what()).find("line 2, column 3"), std::string::npos) << e.what();
+    }
+    ASSERT_THROW(number_parser::parseInteger("12abc"), ParseError);
+    ASSERT_THROW(number_parser::parseInteger(""), ParseError);
+}
+
+TEST(NumberParserTest, ParsesDecimalLists) {
+    ASSERT_EQ(number_parser::parseDoubleList("0.5, 1 ,+2e1,"), (std::vector<double>{0.5, 1.0, 20.0}));
+    auto offsetOf = [](const std::string& text) -> std::size_t {
+        try {
+            number_parser::parseDoubleList(text);
+        } catch (const ParseError& e) {
+            return e.offset();
+        }
+        return std::string::npos;
+    };
+    ASSERT_EQ(offsetOf("0.5,x"), 4u);
+    ASSERT_EQ(offsetOf("0.5,1.5.2"), 4u);
+    ASSERT_EQ(offsetOf("0.5,,1"), 4u);
+    ASSERT_EQ(offsetOf("1,inf"), 2u);
+    ASSERT_EQ(offsetOf("1,1e999"), 2u);
+}
+
+TEST_F(SolverTest, DataSetView_SolvesBorrowedArrays) {
+    // Numbers owned by someone else (a mapped file, a parse buffer).
+    const int numbers[] = {3, 34, 4, 12, 5, 2};
+    const DataSetView view(Span<const int>(numbers, 6), 9);
+    for (const std::string name : {"dp", "backtrack", "sparse", "count"}) {
+        auto result = SolverFactory::createSolver(name)->solve(view);
+        ASSERT_TRUE(result.solution_exists) << name;
+    }
+    auto result = SolverFactory::createSolver("dp")->solve(view);
+    ASSERT_EQ(std::accumulate(result.subsets[0].begin(), result.subsets[0].end(), 0), 9);
+}
+
+TEST(DataSetLoaderTest, LoadsMappedTextFile) {
+    const std::string path = ::testing::TempDir() + "dataset_loader_test.txt";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "3, 34,4,12,5,2\r\n9\n1,1,1,1,1,1\n";
+    }
+    {
+        const MappedFile file(path);
+        ASSERT_EQ(file.view().substr(0, 3), "3, ");
+    }
+    const DataSet data = dataset_loader::loadTextFile(path);
+    ASSERT_EQ(data.numbers, (std::vector<int>{3, 34, 4, 12, 5, 2}));
+    ASSERT_EQ(data.target_sum, 9);
+    ASSERT_EQ(data.values.size(), 6u);
+    std::remove(path.c_str());
+
+    ASSERT_THROW(dataset_loader::loadTextFile(path), std::runtime_error);
+    try {
+        dataset_loader::parseText("1,2\n9\n1,x\n", "input");
+        FAIL() << "expected a ParseError";
+    } catch (const ParseError& e) {
+        ASSERT_EQ(e.offset(), 8u);
+        ASSERT_NE(std::string(e.what()).find("input: 'x' is not a valid integer at line 3, column 3"), std::string::npos)
+            << e.what();
+    }
+}
+
+TEST(BinaryDataSetTest, RoundTripsConcatenatedRecords) {
+    DataSet small;
+    small.numbers = {3, -34, 4, 12, 5, 2};
+    small.target_sum = 9;
+    small.cardinality = CardinalityRule::AtMost;
+    small.cardinality_k = 3;
+    DataSet wide;
+    wide.numbers = {70000, 2, -300};
+    wide.target_sum = 69700;
+    wide.values = {1, 2, 3};
+    std::ostringstream out;
+    binary_dataset::writeRecord(out, small);
+    binary_dataset::writeRecord(out, wide, false);
+
+    // 8-byte aligned copy, as a memory mapping would be.
+    const std::string bytes = out.str();
+    ASSERT_EQ(bytes.size() % 8, 0u);
+    std::vector<std::uint64_t> aligned(bytes.size() / 8);
+    std::memcpy(aligned.data(), bytes.data(), bytes.size());
+    const std::string_view stream(reinterpret_cast<const char*>(aligned.data()), bytes.size());
+    ASSERT_TRUE(binary_dataset::hasMagic(stream));
+
+    binary_dataset::RecordReader reader(stream, "stream");
+    DataSetView record;
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(std::vector<int>(record.numbers.begin(), record.numbers.end()), small.numbers);
+    ASSERT_EQ(record.target_sum, 9);
+    ASSERT_EQ(record.cardinality, CardinalityRule::AtMost);
+    ASSERT_EQ(record.cardinality_k, 3);
+    ASSERT_TRUE(record.values.empty());
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(std::vector<int>(record.numbers.begin(), record.numbers.end()), wide.numbers);
+    ASSERT_EQ(std::vector<int>(record.values.begin(), record.values.end()), wide.values);
+    // 4-byte items are read in place, not copied.
+    ASSERT_GE(reinterpret_cast<const char*>(record.numbers.data()), stream.data());
+    ASSERT_LT(reinterpret_cast<const char*>(record.numbers.data()), stream.data() + stream.size());
+    ASSERT_FALSE(reader.next(record));
+    ASSERT_EQ(reader.recordsRead(), 2u);
+}
+
+TEST(BinaryDataSetTest, RejectsCorruptRecords) {
+    DataSet data;
+    data.numbers = {3, 34, 4, 12, 5, 2};
+    data.target_sum = 9;
+    std::ostringstream out;
+    binary_dataset::writeRecord(out, data);
+    const std::string good = out.str();
+    DataSetView record;
+
+    std::string flipped = good;
+    flipped[binary_dataset::kHeaderSize + 1] ^= 1;
+    binary_dataset::RecordReader corrupt(flipped, "flipped");
+    ASSERT_THROW(corrupt.next(record), std::runtime_error);
+
+    binary_dataset::RecordReader truncated(std::string_view(good).substr(0, binary_dataset::kHeaderSize + 3), "cut");
+    ASSERT_THROW(truncated.next(record), std::runtime_error);
+
+    std::string future = good;
+    future[4] = 2;  // version
+    binary_dataset::RecordReader unsupported(future, "future");
+    try {
+        unsupported.next(record);
+        FAIL() << "expected an unsupported version error";
+    } catch (const std::runtime_error& e) {
+        ASSERT_NE(std::string(e.what()).find("version 2"), std::string::npos) << e.what();
+    }
+}
+
+TEST_F(SolverTest, DataSetLoader_DetectsBinaryFiles) {
+    data.target_sum = 9;
+    const std::string path = ::testing::TempDir() + "dataset_loader_test.ssds";
+    {
+        std::ofstream out(path, std::ios::binary);
+        binary_dataset::writeRecord(out, data);
+    }
+    const DataSet loaded = dataset_loader::loadFile(path);
+    ASSERT_EQ(loaded.numbers, data.numbers);
+    ASSERT_EQ(loaded.target_sum, data.target_sum);
+    ASSERT_TRUE(SolverFactory::createSolver("dp")->solve(loaded).solution_exists);
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        binary_dataset::writeRecord(out, data);
+    }
+    ASSERT_THROW(dataset_loader::loadFile(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(WorkloadGeneratorTest, FamiliesAreReproducibleAndSized) {
+    for (const std::string& name : workload::familyNames()) {
+        WorkloadSpec spec;
+        spec.family = workload::familyFromName(name);
+        ASSERT_EQ(workload::familyName(spec.family), name);
+        spec.n = 200;
+        spec.scale = 100000;
+        spec.seed = 42;
+        const DataSet first = workload::generate(spec);
+        ASSERT_EQ(first.numbers.size(), 200u) << name;
+        ASSERT_EQ(workload::generate(spec).numbers, first.numbers) << name;
+        ASSERT_TRUE(std::all_of(first.numbers.begin(), first.numbers.end(),
+                                [](int x) { return x >= 1 && x <= 100000; })) << name;
+        ASSERT_GT(first.target_sum, 0) << name;
+        spec.seed = 43;
+        ASSERT_NE(workload::generate(spec).numbers, first.numbers) << name;
+    }
+    ASSERT_THROW(workload::familyFromName("gaussian"), std::invalid_argument);
+
+    // Scale is lowered so the total (and any target) fits in an int.
+    WorkloadSpec huge;
+    huge.family = WorkloadFamily::Chvatal;
+    huge.n = 1000;
+    huge.scale = INT_MAX;
+    const DataSet chvatal = workload::generate(huge);
+    ASSERT_LE(std::accumulate(chvatal.numbers.begin(), chvatal.numbers.end(), 0LL), static_cast<long long>(INT_MAX));
+}
+
+TEST(WorkloadGeneratorTest, MatchesGoldenInstances) {
+    // Pins the draw order, so a compiler or refactor that consumes the
+    // random stream differently shows up here.
+    WorkloadSpec spec;
+    spec.n = 8;
+    spec.scale = 1000000;
+    spec.seed = 42;
+    spec.family = WorkloadFamily::Uniform;
+    DataSet data = workload::generate(spec);
+    ASSERT_EQ(data.numbers, (std::vector<int>{120407, 494825, 741451, 155663, 439382, 978429, 613537, 566145}));
+    ASSERT_EQ(data.target_sum, 1356683);
+    // Ledger line items are log-normal (Box-Muller draws).
+    spec.family = WorkloadFamily::Ledger;
+    data = workload::generate(spec);
+    ASSERT_EQ(data.numbers, (std::vector<int>{5000, 500, 25806, 8469, 21500, 500, 400, 4600}));
+    ASSERT_EQ(data.target_sum, 31306);
+}
+
+TEST(WorkloadGeneratorTest, RejectsScalesBelowTheFamilysSmallestNumber) {
+    WorkloadSpec spec;
+    spec.n = 10;
+    spec.scale = 0;
+    ASSERT_THROW(workload::generate(spec), std::invalid_argument);
+
+    spec.family = WorkloadFamily::NoSolution;
+    for (int scale : {1, 2}) {
+        spec.scale = scale;
+        ASSERT_THROW(workload::generate(spec), std::invalid_argument) << scale;
+    }
+    spec.family = WorkloadFamily::EvenOdd;
+    spec.scale = 1;
+    ASSERT_THROW(workload::generate(spec), std::invalid_argument);
+
+    // At the minimum every number is the family's smallest, and within scale.
+    spec.scale = 2;
+    ASSERT_EQ(workload::generate(spec).numbers, std::vector<int>(10, 2));
+    spec.family = WorkloadFamily::NoSolution;
+    spec.scale = 3;
+    ASSERT_EQ(workload::generate(spec).numbers, std::vector<int>(10, 3));
+}
+
+TEST(WorkloadGeneratorTest, SolvabilityMatchesFamily) {
+    auto solver = SolverFactory::createSolver("dp");
+    WorkloadSpec spec;
+    spec.n = 30;
+    spec.scale = 500;
+    for (std::uint64_t seed = 1; seed <= 5; ++seed) {
+        spec.seed = seed;
+        for (WorkloadFamily family : {WorkloadFamily::Uniform, WorkloadFamily::PowerLaw, WorkloadFamily::Duplicates,
+                                      WorkloadFamily::Ledger, WorkloadFamily::HighDensity}) {
+            spec.family = family;
+            ASSERT_TRUE(solver->solve(workload::generate(spec)).solution_exists) << workload::familyName(family);
+        }
+        for (WorkloadFamily family : {WorkloadFamily::NoSolution, WorkloadFamily::EvenOdd}) {
+            spec.family = family;
+            ASSERT_FALSE(solver->solve(workload::generate(spec)).solution_exists) << workload::familyName(family);
+        }
+    }
+}
+
+TEST(ReportWriterTest, WritesQuotedCsvAndJsonRows) {
+    std::ostringstream csv;
+    ReportWriter report(&csv);
+    report.add({{"engine", "dp"}, {"case", "a,\"b\""}, {"ms", 1.5}, {"rss", nullptr}});
+    report.add({{"engine", "sparse"}, {"case", "c"}, {"ms", 2}, {"rss", 64}});
+    ASSERT_EQ(csv.str(), "engine,case,ms,rss\ndp,\"a,\"\"b\"\"\",1.5,\nsparse,c,2,64\n");
+    ASSERT_EQ(report.rows().size(), 2u);
+    ASSERT_EQ(report.rows()[0]["case"], "a,\"b\"");
+    ASSERT_TRUE(report.rows()[0]["rss"].is_null());
+
+    ReportWriter json_only(nullptr);
+    json_only.add({{"n", 1}});
+    ASSERT_EQ(json_only.rows().dump(), "[{\"n\":1}]");
+}
+
+TEST(ScalingSweepTest, RunsEveryEngineOverTheGrid) {
+    SweepConfig config;
+    config.sizes = {8, 4};
+    config.targets = {50};
+    config.densities = {1.0, 2.0};
+    config.engines = {"dp", "knapsack-dp", "no-such-engine"};
+    config.iterations = 2;
+    config.warmup_iterations = 0;
+    int callbacks = 0;
+    const auto points = scaling_sweep::run(config, [&](const SweepPoint&) { ++callbacks; });
+    ASSERT_EQ(points.size(), 2u * 2u * 3u);
+    ASSERT_EQ(callbacks, 12);
+    ASSERT_EQ(points.front().n, 4u);  // sizes run in ascending order
+    for (const SweepPoint& point : points) {
+        if (point.engine == "no-such-engine") {
+            ASSERT_EQ(point.outcome, SweepOutcome::Failed);
+            ASSERT_FALSE(point.error.empty());
+        } else {
+            ASSERT_EQ(point.outcome, SweepOutcome::Ok) << point.engine;
+            ASSERT_EQ(point.bench.iterations, 2);
+        }
+    }
+
+    ASSERT_EQ(scaling_sweep::scaleFor(10, 1.0), 1024);
+    ASSERT_EQ(scaling_sweep::scaleFor(10, 2.0), 32);
+    ASSERT_EQ(scaling_sweep::scaleFor(100, 1.0), INT_MAX / 100);
+    ASSERT_THROW(scaling_sweep::scaleFor(10, 0.0), std::invalid_argument);
+}
+
+TEST(ThroughputBenchmarkTest, SolvesOnEveryThread) {
+    ThroughputConfig config;
+    config.thread_counts = {1, 3};
+    config.instances_per_thread = 4;
+    config.duration = std::chrono::milliseconds(30);
+    std::vector<int> seen;
+    const auto points = throughput_benchmark::run(config, [&](const ThroughputPoint& p) { seen.push_back(p.threads); });
+    ASSERT_EQ(seen, (std::vector<int>{1, 3}));
+    ASSERT_EQ(points.size(), 2u);
+    ASSERT_DOUBLE_EQ(points[0].efficiency, 1.0);
+    for (const ThroughputPoint& point : points) {
+        ASSERT_EQ(point.solves_per_thread.size(), static_cast<std::size_t>(point.threads));
+        for (const std::uint64_t solves : point.solves_per_thread) ASSERT_GT(solves, 0u);
+        ASSERT_EQ(point.solutions_found, point.solves);  // uniform targets are reachable
+        ASSERT_EQ(point.latency.count, point.solves);
+        ASSERT_GT(point.solves_per_second, 0.0);
+        ASSERT_GT(point.allocations_per_solve, 0.0);
+        ASSERT_LE(point.latency.p50, point.latency.p99);
+    }
+
+    config.engine = "sparse";
+    config.find_all = true;  // rejected by the engine on its worker thread
+    ASSERT_THROW(throughput_benchmark::run(config), std::runtime_error);
+    config.thread_counts = {0};
+    ASSERT_THROW(throughput_benchmark::run(config), std::invalid_argument);
+}
+
+TEST(BenchmarkStatsTest, MannWhitneyDetectsShifts) {
+    std::vector<double> low, high;
+    for (int i = 1; i <= 10; ++i) {
+        low.push_back(i);
+        high.push_back(i + 10);
+    }
+    // Matches scipy.stats.mannwhitneyu(low, high, method="asymptotic").
+    ASSERT_NEAR(benchmark_stats::mannWhitneyPValue(low, high), 1.8267e-4, 1e-7);
+    ASSERT_NEAR(benchmark_stats::mannWhitneyPValue(low, low), 1.0, 1e-12);
+    ASSERT_DOUBLE_EQ(benchmark_stats::mannWhitneyPValue({2.0, 2.0}, {2.0, 2.0}), 1.0);
+    ASSERT_DOUBLE_EQ(benchmark_stats::mannWhitneyPValue({}, high), 1.0);
+}
+
+TEST(BaselineTest, SavesAndFlagsSignificantRegressions) {
+    std::vector<double> fast, slow, noisy;
+    for (int i = 0; i < 20; ++i) {
+        fast.push_back(1.0 + 0.01 * i);
+        slow.push_back(1.5 + 0.01 * i);
+        noisy.push_back(i % 2 ? 1.02 : 1.08);
+    }
+    const std::string path = ::testing::TempDir() + "baseline_test.json";
+    Baseline before{"main", {{"dp small", fast}, {"sparse small", fast}, {"gone", fast}}};
+    baseline::save(path, before);
+    const Baseline loaded = baseline::load(path);
+    ASSERT_EQ(loaded.name, "main");
+    ASSERT_EQ(loaded.cases.size(), 3u);
+    ASSERT_EQ(loaded.find("dp small")->samples_ms, fast);
+
+    Baseline after{"branch", {{"dp small", slow}, {"sparse small", noisy}, {"new", fast}}};
+    const auto comparisons = baseline::compare(loaded, after, 0.05);
+    ASSERT_EQ(comparisons.size(), 4u);
+    ASSERT_TRUE(comparisons[0].regression);
+    ASSERT_NEAR(comparisons[0].ratio, 1.5 / 1.0 * (1.0 + 0.095 / 1.5) / (1.0 + 0.095), 1e-9);
+    ASSERT_FALSE(comparisons[1].regression);  // within noise of the baseline
+    ASSERT_FALSE(comparisons[2].baseline_median_ms.has_value());
+    ASSERT_FALSE(comparisons[3].current_median_ms.has_value());
+    std::ostringstream report;
+    ASSERT_EQ(baseline::writeReport(report, loaded.name, comparisons), 1);
+    ASSERT_NE(report.str().find("dp small: 1.095 ms -> 1.595 ms"), std::string::npos) << report.str();
+
+    Baseline merged = baseline::loadOrCreate(path, "main-2");
+    merged.put({"dp small", slow});
+    ASSERT_EQ(merged.cases.size(), 3u);
+    ASSERT_EQ(merged.find("dp small")->samples_ms, slow);
+    std::remove(path.c_str());
+    ASSERT_THROW(baseline::load(path), std::runtime_error);
+}